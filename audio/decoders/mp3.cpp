@@ -24,6 +24,7 @@
 
 #ifdef USE_MAD
 
+#include "common/array.h"
 #include "common/debug.h"
 #include "common/ptr.h"
 #include "common/stream.h"
@@ -72,6 +73,29 @@ protected:
 	// This buffer contains a slab of input data
 	byte _buf[BUFFER_SIZE + MAD_BUFFER_GUARD];
 
+	// Seek table, filled while the stream length is determined. It holds
+	// the offset and start time of every SEEK_POINT_INTERVAL-th frame, so
+	// that seeking only needs to scan the headers of a few frames.
+	struct SeekPoint {
+		uint32 offset;
+		mad_timer_t time;
+	};
+
+	enum {
+		SEEK_POINT_INTERVAL = 16,
+		// Number of frames decoded before the destination of a seek. Layer III
+		// frames may use up to 511 bytes of the frames before them (the bit
+		// reservoir), which these cover at all but the lowest bitrates.
+		RESERVOIR_FRAMES = 8
+	};
+
+	Common::Array<SeekPoint> _seekTable;
+	bool _buildSeekTable;
+	uint32 _frameCount;
+
+	// Offset of the first frame, behind any ID3v2 tags
+	uint32 _dataStart;
+
 public:
 	MP3Stream(Common::SeekableReadStream *inStream,
 	               DisposeAfterUse::Flag dispose);
@@ -89,9 +113,13 @@ protected:
 	void decodeMP3Data();
 	void readMP3Data();
 
-	void initStream();
+	void initStream(uint32 offset, const mad_timer_t &time = mad_timer_zero);
 	void readHeader();
 	void deinitStream();
+
+	uint32 skipID3v2Tags();
+
+	const SeekPoint *findSeekPoint(const mad_timer_t &where) const;
 };
 
 MP3Stream::MP3Stream(Common::SeekableReadStream *inStream, DisposeAfterUse::Flag dispose) :
@@ -99,18 +127,26 @@ MP3Stream::MP3Stream(Common::SeekableReadStream *inStream, DisposeAfterUse::Flag
 	_posInFrame(0),
 	_state(MP3_STATE_INIT),
 	_length(0, 1000),
-	_curTime(mad_timer_zero) {
+	_curTime(mad_timer_zero),
+	_buildSeekTable(false),
+	_frameCount(0),
+	_dataStart(0) {
 
 	// The MAD_BUFFER_GUARD must always contain zeros (the reason
 	// for this is that the Layer III Huffman decoder of libMAD
 	// may read a few bytes beyond the end of the input buffer).
 	memset(_buf + BUFFER_SIZE, 0, MAD_BUFFER_GUARD);
 
-	// Calculate the length of the stream
-	initStream();
+	_dataStart = skipID3v2Tags();
 
+	// Calculate the length of the stream, and build the seek table along
+	// the way
+	initStream(_dataStart);
+
+	_buildSeekTable = true;
 	while (_state != MP3_STATE_EOS)
 		readHeader();
+	_buildSeekTable = false;
 
 	// To rule out any invalid sample rate to be encountered here, say in case the
 	// MP3 stream is invalid, we just check the MAD error code here.
@@ -138,7 +174,7 @@ MP3Stream::~MP3Stream() {
 void MP3Stream::decodeMP3Data() {
 	do {
 		if (_state == MP3_STATE_INIT)
-			initStream();
+			initStream(_dataStart);
 
 		if (_state == MP3_STATE_EOS)
 			return;
@@ -150,6 +186,10 @@ void MP3Stream::decodeMP3Data() {
 		while (_state == MP3_STATE_READY) {
 			_stream.error = MAD_ERROR_NONE;
 
+			// If the header of the frame has already been read by readHeader(),
+			// libmad decodes that frame, and its duration has been added already.
+			const bool headerCounted = (_frame.header.flags & MAD_FLAG_INCOMPLETE) != 0;
+
 			// Decode the next frame
 			if (mad_frame_decode(&_frame, &_stream) == -1) {
 				if (_stream.error == MAD_ERROR_BUFLEN) {
@@ -167,7 +207,8 @@ void MP3Stream::decodeMP3Data() {
 			}
 
 			// Sum up the total playback time so far
-			mad_timer_add(&_curTime, _frame.header.duration);
+			if (!headerCounted)
+				mad_timer_add(&_curTime, _frame.header.duration);
 			// Synthesize PCM data
 			mad_synth_frame(&_synth, &_frame);
 			_posInFrame = 0;
@@ -217,23 +258,68 @@ bool MP3Stream::seek(const Timestamp &where) {
 		return false;
 	}
 
-	const uint32 time = where.msecs();
-
 	mad_timer_t destination;
-	mad_timer_set(&destination, time / 1000, time % 1000, 1000);
-
-	if (_state != MP3_STATE_READY || mad_timer_compare(destination, _curTime) < 0)
-		initStream();
+	mad_timer_set(&destination, 0, where.convertToFramerate(getRate()).totalNumberOfFrames(), getRate());
+
+	// Jump to the closest known frame far enough before the destination to
+	// fill the bit reservoir, unless we are already closer to it
+	const SeekPoint *seekPoint = findSeekPoint(destination);
+	if (_state != MP3_STATE_READY || mad_timer_compare(destination, _curTime) < 0 ||
+		(seekPoint && mad_timer_compare(seekPoint->time, _curTime) > 0)) {
+		if (seekPoint)
+			initStream(seekPoint->offset, seekPoint->time);
+		else
+			initStream(_dataStart);
+	}
 
-	while (mad_timer_compare(destination, _curTime) > 0 && _state != MP3_STATE_EOS)
+	// Walk up to the frame containing the destination. The frames on the way
+	// are decoded, so the bit reservoir is filled, but not synthesized.
+	while (_state == MP3_STATE_READY) {
 		readHeader();
+		if (_state != MP3_STATE_READY || mad_timer_compare(_curTime, destination) > 0)
+			break;
+
+		// Errors are expected for the first frames after a jump, since
+		// their reservoir data is missing, and are harmless here.
+		_stream.error = MAD_ERROR_NONE;
+		if (mad_frame_decode(&_frame, &_stream) == -1 && !MAD_RECOVERABLE(_stream.error)) {
+			warning("MP3Stream: Unrecoverable error in mad_frame_decode (%s)", mad_stream_errorstr(&_stream));
+			_state = MP3_STATE_EOS;
+		}
+	}
 
+	// Decode the frame containing the destination, whose header has been
+	// read above
 	decodeMP3Data();
 
 	return (_state != MP3_STATE_EOS);
 }
 
-void MP3Stream::initStream() {
+const MP3Stream::SeekPoint *MP3Stream::findSeekPoint(const mad_timer_t &where) const {
+	mad_timer_t margin = _frame.header.duration;
+	mad_timer_multiply(&margin, RESERVOIR_FRAMES);
+
+	// Binary search for the last seek point at least RESERVOIR_FRAMES
+	// frames before the given time
+	int first = 0, last = (int)_seekTable.size() - 1;
+	const SeekPoint *result = 0;
+
+	while (first <= last) {
+		const int middle = (first + last) / 2;
+		mad_timer_t time = _seekTable[middle].time;
+		mad_timer_add(&time, margin);
+		if (mad_timer_compare(time, where) <= 0) {
+			result = &_seekTable[middle];
+			first = middle + 1;
+		} else {
+			last = middle - 1;
+		}
+	}
+
+	return result;
+}
+
+void MP3Stream::initStream(uint32 offset, const mad_timer_t &time) {
 	if (_state != MP3_STATE_INIT)
 		deinitStream();
 
@@ -243,8 +329,8 @@ void MP3Stream::initStream() {
 	mad_synth_init(&_synth);
 
 	// Reset the stream data
-	_inStream->seek(0, SEEK_SET);
-	_curTime = mad_timer_zero;
+	_inStream->seek(offset, SEEK_SET);
+	_curTime = time;
 	_posInFrame = 0;
 
 	// Update state
@@ -281,6 +367,13 @@ void MP3Stream::readHeader() {
 			}
 		}
 
+		if (_buildSeekTable && (_frameCount++ % SEEK_POINT_INTERVAL) == 0) {
+			SeekPoint seekPoint;
+			seekPoint.offset = _inStream->pos() - (_stream.bufend - _stream.this_frame);
+			seekPoint.time = _curTime;
+			_seekTable.push_back(seekPoint);
+		}
+
 		// Sum up the total playback time so far
 		mad_timer_add(&_curTime, _frame.header.duration);
 		break;
@@ -290,6 +383,28 @@ void MP3Stream::readHeader() {
 		_state = MP3_STATE_EOS;
 }
 
+uint32 MP3Stream::skipID3v2Tags() {
+	// libmad does not know about ID3v2 tags, and their contents (e.g. embedded
+	// pictures) may look like frame headers, which would end up in the stream
+	// length and the seek table.
+	uint32 offset = 0;
+	byte header[10];
+
+	while (_inStream->seek(offset, SEEK_SET) && _inStream->read(header, 10) == 10 && !memcmp(header, "ID3", 3)) {
+		// The size is a 28 bit "syncsafe" integer
+		if ((header[6] | header[7] | header[8] | header[9]) & 0x80)
+			break;
+
+		offset += 10 + ((header[6] << 21) | (header[7] << 14) | (header[8] << 7) | header[9]);
+
+		// Footer present
+		if (header[5] & 0x10)
+			offset += 10;
+	}
+
+	return offset;
+}
+
 void MP3Stream::deinitStream() {
 	if (_state == MP3_STATE_INIT)
 		return;
@@ -0,0 +1,237 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#include "common/debug.h"
+#include "common/util.h"
+
+#include "audio/audiostream.h"
+#include "audio/pcmcache.h"
+
+namespace Common {
+DECLARE_SINGLETON(Audio::PCMCache);
+}
+
+namespace Audio {
+
+enum {
+	/** Default memory budget of the cache in bytes */
+	kDefaultMaxMemory = 4 * 1024 * 1024,
+	/** Default maximum length of cached sounds in milliseconds */
+	kDefaultMaxLength = 5000,
+	/** Number of samples decoded at once */
+	kDecodeChunkSize = 4096
+};
+
+#pragma mark -
+#pragma mark --- Decoded sound stream ---
+#pragma mark -
+
+/**
+ * A stream playing back fully decoded samples, which it owns.
+ */
+class DecodedSoundStream : public SeekableAudioStream {
+public:
+	DecodedSoundStream(int16 *data, uint32 numSamples, int rate, bool stereo)
+		: _data(data), _numSamples(numSamples), _rate(rate), _stereo(stereo), _pos(0) {}
+	~DecodedSoundStream() { delete[] _data; }
+
+	int readBuffer(int16 *buffer, const int numSamples) {
+		const int samples = MIN<int>(numSamples, _numSamples - _pos);
+		memcpy(buffer, _data + _pos, samples * sizeof(int16));
+		_pos += samples;
+		return samples;
+	}
+
+	bool isStereo() const { return _stereo; }
+	int getRate() const { return _rate; }
+	bool endOfData() const { return _pos >= _numSamples; }
+
+	bool seek(const Timestamp &where) {
+		const uint32 channels = _stereo ? 2 : 1;
+		const uint32 frame = where.convertToFramerate(_rate).totalNumberOfFrames();
+
+		if (frame * channels > _numSamples) {
+			_pos = _numSamples;
+			return false;
+		}
+
+		_pos = frame * channels;
+		return true;
+	}
+
+	Timestamp getLength() const {
+		return Timestamp(0, _numSamples / (_stereo ? 2 : 1), _rate);
+	}
+
+private:
+	int16 *_data;
+	const uint32 _numSamples;
+	const int _rate;
+	const bool _stereo;
+	uint32 _pos;
+};
+
+SeekableAudioStream *makeDecodedSoundStream(const DecodedSound &sound) {
+	int16 *data = new int16[sound.numSamples];
+	memcpy(data, sound.data, sound.numSamples * sizeof(int16));
+	return new DecodedSoundStream(data, sound.numSamples, sound.rate, sound.stereo);
+}
+
+#pragma mark -
+#pragma mark --- PCM cache ---
+#pragma mark -
+
+PCMCache::PCMCache()
+	: _memory(0), _maxMemory(kDefaultMaxMemory), _maxLength(kDefaultMaxLength),
+	  _clock(0), _hits(0), _misses(0) {
+}
+
+PCMCache::~PCMCache() {
+	clear();
+}
+
+SeekableAudioStream *PCMCache::getStream(const Common::String &key) {
+	EntryMap::iterator it = _entries.find(key);
+	if (it == _entries.end()) {
+		_misses++;
+		debug(5, "PCMCache: miss for '%s' (%d hits, %d misses)", key.c_str(), _hits, _misses);
+		return 0;
+	}
+
+	_hits++;
+	it->_value.lastUsed = ++_clock;
+	debug(5, "PCMCache: hit for '%s' (%d hits, %d misses)", key.c_str(), _hits, _misses);
+	return makeDecodedSoundStream(*it->_value.sound);
+}
+
+SeekableAudioStream *PCMCache::addStream(const Common::String &key, SeekableAudioStream *stream, DisposeAfterUse::Flag disposeAfterUse) {
+	if (!stream)
+		return 0;
+
+	DecodedSound *sound = decode(stream);
+	if (!sound) {
+		debug(5, "PCMCache: not caching '%s'", key.c_str());
+		return stream;
+	}
+
+	if (disposeAfterUse == DisposeAfterUse::YES)
+		delete stream;
+
+	const uint32 size = sound->numSamples * sizeof(int16);
+
+	EntryMap::iterator it = _entries.find(key);
+	if (it != _entries.end()) {
+		_memory -= it->_value.sound->numSamples * sizeof(int16);
+		_entries.erase(it);
+	}
+
+	// Sounds bigger than the whole budget are still played from the decoded
+	// data, they just do not push anything else out of the cache.
+	if (size > _maxMemory) {
+		debug(5, "PCMCache: '%s' is too big to be cached (%d bytes)", key.c_str(), size);
+		SeekableAudioStream *decoded = new DecodedSoundStream(sound->data, sound->numSamples, sound->rate, sound->stereo);
+		sound->data = 0;
+		delete sound;
+		return decoded;
+	}
+
+	freeOldSounds(size);
+
+	Entry entry;
+	entry.sound = DecodedSoundPtr(sound);
+	entry.lastUsed = ++_clock;
+	_entries[key] = entry;
+	_memory += size;
+
+	debug(5, "PCMCache: cached '%s' (%d bytes, %d of %d bytes used)", key.c_str(), size, _memory, _maxMemory);
+	return makeDecodedSoundStream(*sound);
+}
+
+DecodedSound *PCMCache::decode(SeekableAudioStream *stream) {
+	const int rate = stream->getRate();
+	const uint32 channels = stream->isStereo() ? 2 : 1;
+	const Timestamp length = stream->getLength();
+
+	// Streams which do not know their length can not be checked up front
+	if (rate <= 0 || length.totalNumberOfFrames() == 0 || (uint32)length.msecs() > _maxLength)
+		return 0;
+
+	// The length of some formats is only an estimate, so allow for a bit of
+	// slack before giving up.
+	const uint32 maxSamples = ((_maxLength + 100) * rate / 1000) * channels;
+	uint32 capacity = MIN<uint32>(length.convertToFramerate(rate).totalNumberOfFrames() * channels + kDecodeChunkSize, maxSamples);
+	int16 *data = new int16[capacity];
+	uint32 numSamples = 0;
+
+	while (!stream->endOfData()) {
+		if (numSamples + kDecodeChunkSize > capacity) {
+			if (capacity >= maxSamples) {
+				delete[] data;
+				stream->rewind();
+				return 0;
+			}
+
+			capacity = MIN<uint32>(capacity * 2, maxSamples);
+			int16 *newData = new int16[capacity];
+			memcpy(newData, data, numSamples * sizeof(int16));
+			delete[] data;
+			data = newData;
+		}
+
+		const int samples = stream->readBuffer(data + numSamples, MIN<uint32>(kDecodeChunkSize, capacity - numSamples));
+		if (samples <= 0)
+			break;
+		numSamples += samples;
+	}
+
+	DecodedSound *sound = new DecodedSound();
+	sound->data = data;
+	sound->numSamples = numSamples;
+	sound->rate = rate;
+	sound->stereo = (channels == 2);
+	return sound;
+}
+
+void PCMCache::freeOldSounds(uint32 neededBytes) {
+	while (!_entries.empty() && _memory + neededBytes > _maxMemory) {
+		EntryMap::iterator oldest = _entries.begin();
+		for (EntryMap::iterator it = _entries.begin(); it != _entries.end(); ++it) {
+			if (it->_value.lastUsed < oldest->_value.lastUsed)
+				oldest = it;
+		}
+
+		_memory -= oldest->_value.sound->numSamples * sizeof(int16);
+		_entries.erase(oldest);
+	}
+}
+
+void PCMCache::clear() {
+	_entries.clear();
+	_memory = 0;
+}
+
+void PCMCache::setMaxMemory(uint32 bytes) {
+	_maxMemory = bytes;
+	freeOldSounds(0);
+}
+
+} // End of namespace Audio
@@ -0,0 +1,150 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#ifndef AUDIO_PCMCACHE_H
+#define AUDIO_PCMCACHE_H
+
+#include "common/hashmap.h"
+#include "common/hash-str.h"
+#include "common/ptr.h"
+#include "common/singleton.h"
+#include "common/str.h"
+#include "common/types.h"
+
+namespace Audio {
+
+class SeekableAudioStream;
+
+/**
+ * Fully decoded PCM data of a sound, as stored in the cache.
+ */
+struct DecodedSound {
+	DecodedSound() : data(0), numSamples(0), rate(0), stereo(false) {}
+	~DecodedSound() { delete[] data; }
+
+	int16 *data;
+	uint32 numSamples; ///< number of int16 samples in data (not frames)
+	int rate;
+	bool stereo;
+};
+
+/**
+ * Cache for the decoded PCM data of short compressed sounds.
+ *
+ * Decoding a MP3, Vorbis, FLAC or ADPCM sound effect is far more expensive
+ * than playing back raw samples, and engines tend to replay the same short
+ * effects over and over. This cache keeps the decoded samples of such sounds
+ * around, keyed by a string identifying the source (e.g. the file name plus
+ * offset of the sound), and hands out streams playing a copy of the decoded
+ * samples. Copying is much cheaper than decoding again, and lets the mixer
+ * destroy the streams on its own thread without touching the cache.
+ *
+ * Typical usage:
+ * @code
+ * Audio::SeekableAudioStream *stream = PCMCacheMan.getStream(key);
+ * if (!stream)
+ *     stream = PCMCacheMan.addStream(key, Audio::makeMP3Stream(file, DisposeAfterUse::YES));
+ * @endcode
+ *
+ * Only sounds shorter than getMaxLength() are cached. The cache evicts the
+ * least recently used sounds once its memory budget is exceeded. The cache
+ * itself must only be used from the engine thread.
+ */
+class PCMCache : public Common::Singleton<PCMCache> {
+public:
+	PCMCache();
+	~PCMCache();
+
+	/**
+	 * Returns a new stream playing the cached sound stored under the given
+	 * key, or 0 when the sound is not in the cache.
+	 */
+	SeekableAudioStream *getStream(const Common::String &key);
+
+	/**
+	 * Decodes the given stream and stores it in the cache under the given
+	 * key, if it is short enough to be cached.
+	 *
+	 * On success, the stream is consumed (and deleted, if requested) and a
+	 * stream reading from the cached data is returned. Otherwise, the stream
+	 * itself is returned, rewound to its start.
+	 *
+	 * @param key             Key identifying the source of the sound.
+	 * @param stream          The stream to decode. May be 0.
+	 * @param disposeAfterUse Whether to delete the stream once it was cached.
+	 * @return A stream playing the sound.
+	 */
+	SeekableAudioStream *addStream(const Common::String &key, SeekableAudioStream *stream,
+	                               DisposeAfterUse::Flag disposeAfterUse = DisposeAfterUse::YES);
+
+	/** Removes all sounds from the cache. */
+	void clear();
+
+	/** Sets the memory budget of the cache in bytes, evicting sounds if needed. */
+	void setMaxMemory(uint32 bytes);
+	uint32 getMaxMemory() const { return _maxMemory; }
+	uint32 getMemory() const { return _memory; }
+
+	/** Sets the maximum length (in milliseconds) of sounds to be cached. */
+	void setMaxLength(uint32 msecs) { _maxLength = msecs; }
+	uint32 getMaxLength() const { return _maxLength; }
+
+	uint32 getHits() const { return _hits; }
+	uint32 getMisses() const { return _misses; }
+
+private:
+	friend class Common::Singleton<SingletonBaseType>;
+
+	typedef Common::SharedPtr<DecodedSound> DecodedSoundPtr;
+
+	struct Entry {
+		DecodedSoundPtr sound;
+		uint32 lastUsed;
+	};
+
+	typedef Common::HashMap<Common::String, Entry> EntryMap;
+
+	DecodedSound *decode(SeekableAudioStream *stream);
+	void freeOldSounds(uint32 neededBytes);
+
+	EntryMap _entries;
+	uint32 _memory;
+	uint32 _maxMemory;
+	uint32 _maxLength;
+	uint32 _clock;
+
+	uint32 _hits;
+	uint32 _misses;
+};
+
+/**
+ * Creates a stream playing back a copy of the given decoded sound. The
+ * stream does not reference the sound afterwards.
+ */
+SeekableAudioStream *makeDecodedSoundStream(const DecodedSound &sound);
+
+} // End of namespace Audio
+
+/** Shortcut for accessing the PCM cache. */
+#define PCMCacheMan Audio::PCMCache::instance()
+
+#endif
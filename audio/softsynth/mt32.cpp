@@ -37,7 +37,9 @@
 #include "common/error.h"
 #include "common/events.h"
 #include "common/file.h"
+#include "common/mutex.h"
 #include "common/system.h"
+#include "common/timer.h"
 #include "common/util.h"
 #include "common/archive.h"
 #include "common/textconsole.h"
@@ -92,6 +94,21 @@ class MidiChannel_MT32 : public MidiChannel_MPU401 {
 
 class MidiDriver_MT32 : public MidiDriver_Emulated {
 private:
+	enum {
+		/** Size of the render ahead buffer in samples (i.e. 8192 stereo frames, 256ms) */
+		kRenderAheadSize = 16384,
+		/** Minimum number of samples kept rendered ahead (i.e. 2048 stereo frames, 64ms) */
+		kRenderAheadMin = 4096,
+		/** Number of samples rendered ahead at once */
+		kRenderAheadChunk = 256,
+		/**
+		 * Time in ms a timer callback may spend rendering ahead. The timer
+		 * thread is shared with other callbacks, like music players, which
+		 * must not be starved.
+		 */
+		kRenderAheadBudget = 4
+	};
+
 	MidiChannel_MT32 _midiChannels[16];
 	uint16 _channelMask;
 	MT32Emu::Synth *_synth;
@@ -102,6 +119,24 @@ private:
 
 	int _outputRate;
 
+	// Render ahead support. The synth is rendered ahead of the mixer from a
+	// timer callback, so the mixer callback only copies samples. It never
+	// renders itself: rendering runs the player callbacks, which may use the
+	// mixer, and waiting for them from the mixer callback could deadlock.
+	// If the buffer runs dry, silence is played and counted as an underrun.
+	// _bufferMutex protects the buffer and the values below it.
+	bool _renderAhead;
+	Common::Mutex _bufferMutex;
+	int16 *_renderBuffer;
+	uint _renderBufferRead;
+	uint _renderBufferFill;
+	/** Largest number of samples requested by the mixer at once */
+	uint _mixerRequestSize;
+	uint32 _underruns;
+
+	static void renderAheadProc(void *refCon);
+	void renderAhead();
+
 protected:
 	void generateSamples(int16 *buf, int len);
 
@@ -122,6 +157,7 @@ public:
 	MidiChannel *getPercussionChannel();
 
 	// AudioStream API
+	int readBuffer(int16 *data, const int numSamples);
 	bool isStereo() const { return true; }
 	int getRate() const { return _outputRate; }
 };
@@ -151,6 +187,13 @@ MidiDriver_MT32::MidiDriver_MT32(Audio::Mixer *mixer) : MidiDriver_Emulated(mixe
 	_pcmROM = NULL;
 	_controlFile = NULL;
 	_pcmFile = NULL;
+
+	_renderAhead = false;
+	_renderBuffer = NULL;
+	_renderBufferRead = 0;
+	_renderBufferFill = 0;
+	_mixerRequestSize = 0;
+	_underruns = 0;
 }
 
 MidiDriver_MT32::~MidiDriver_MT32() {
@@ -174,6 +217,9 @@ void MidiDriver_MT32::deleteMuntStructures() {
 	_controlFile = NULL;
 	delete _pcmFile;
 	_pcmFile = NULL;
+
+	delete[] _renderBuffer;
+	_renderBuffer = NULL;
 }
 
 int MidiDriver_MT32::open() {
@@ -222,6 +268,16 @@ int MidiDriver_MT32::open() {
 
 	g_system->updateScreen();
 
+	_renderAhead = ConfMan.getBool("mt32_render_ahead");
+	if (_renderAhead) {
+		_renderBuffer = new int16[kRenderAheadSize];
+		_renderBufferRead = 0;
+		_renderBufferFill = 0;
+		_mixerRequestSize = 0;
+		_underruns = 0;
+		g_system->getTimerManager()->installTimerProc(renderAheadProc, 10000, this, "MT32RenderAhead");
+	}
+
 	_mixer->playStream(Audio::Mixer::kPlainSoundType, &_mixerSoundHandle, this, -1, Audio::Mixer::kMaxChannelVolume, 0, DisposeAfterUse::NO, true);
 
 	return 0;
@@ -261,6 +317,12 @@ void MidiDriver_MT32::close() {
 		return;
 	_isOpen = false;
 
+	// Stop rendering ahead
+	if (_renderAhead) {
+		g_system->getTimerManager()->removeTimerProc(renderAheadProc);
+		if (_underruns)
+			debug(1, "MT-32: The render ahead buffer ran dry %d times", _underruns);
+	}
 	// Detach the player callback handler
 	setTimerCallback(NULL, NULL);
 	// Detach the mixer callback handler
@@ -274,6 +336,73 @@ void MidiDriver_MT32::generateSamples(int16 *data, int len) {
 	_synth->render(data, len);
 }
 
+void MidiDriver_MT32::renderAheadProc(void *refCon) {
+	((MidiDriver_MT32 *)refCon)->renderAhead();
+}
+
+void MidiDriver_MT32::renderAhead() {
+	int16 chunk[kRenderAheadChunk];
+	const uint32 startTime = g_system->getMillis();
+
+	for (;;) {
+		uint fill, target, needed;
+		{
+			// Only the mixer callback empties the buffer, so once there is
+			// room for a chunk, it stays there.
+			Common::StackLock bufferLock(_bufferMutex);
+			fill = _renderBufferFill;
+			needed = _mixerRequestSize;
+		}
+
+		// Keep enough samples for two mixer callbacks
+		target = MIN<uint>(kRenderAheadSize, MAX<uint>(kRenderAheadMin, 2 * needed));
+		if (fill + kRenderAheadChunk > target)
+			return;
+
+		// Stay within the time budget, unless the next mixer callback would
+		// run dry otherwise.
+		if (fill >= needed && g_system->getMillis() - startTime >= kRenderAheadBudget)
+			return;
+
+		// This also runs the player callbacks, so MIDI events keep being
+		// timestamped at the exact sample position they are rendered at.
+		MidiDriver_Emulated::readBuffer(chunk, kRenderAheadChunk);
+
+		Common::StackLock bufferLock(_bufferMutex);
+		uint pos = (_renderBufferRead + _renderBufferFill) % kRenderAheadSize;
+		for (int i = 0; i < kRenderAheadChunk; ++i) {
+			_renderBuffer[pos] = chunk[i];
+			if (++pos == kRenderAheadSize)
+				pos = 0;
+		}
+		_renderBufferFill += kRenderAheadChunk;
+	}
+}
+
+int MidiDriver_MT32::readBuffer(int16 *data, const int numSamples) {
+	if (!_renderAhead)
+		return MidiDriver_Emulated::readBuffer(data, numSamples);
+
+	Common::StackLock lock(_bufferMutex);
+	_mixerRequestSize = MAX<uint>(_mixerRequestSize, numSamples);
+
+	int copied = 0;
+	while (copied < numSamples && _renderBufferFill > 0) {
+		const uint count = MIN<uint>(numSamples - copied, MIN<uint>(_renderBufferFill, kRenderAheadSize - _renderBufferRead));
+		memcpy(data + copied, _renderBuffer + _renderBufferRead, count * sizeof(int16));
+		copied += count;
+		_renderBufferFill -= count;
+		_renderBufferRead = (_renderBufferRead + count) % kRenderAheadSize;
+	}
+
+	if (copied < numSamples) {
+		memset(data + copied, 0, (numSamples - copied) * sizeof(int16));
+		++_underruns;
+	}
+
+	return numSamples;
+}
+
 uint32 MidiDriver_MT32::property(int prop, uint32 param) {
 	switch (prop) {
 	case PROP_CHANNEL_MASK:
@@ -595,6 +595,21 @@ INLINE Bits Operator::GetSample( Bits modulation ) {
 	}
 }
 
+INLINE bool Operator::Steady() const {
+	//Off never changes, sustain only changes once the sustain bit gets cleared
+	return state == OFF || ( state == SUSTAIN && ( reg20 & MASK_SUSTAIN ) );
+}
+
+INLINE Bitu Operator::SteadyVolume() const {
+	return currentLevel + ( state == OFF ? ENV_MAX : volume );
+}
+
+INLINE OperatorRender Operator::BlockRender() const {
+	if ( !Steady() )
+		return orEnvelope;
+	return ENV_SILENT( SteadyVolume() ) ? orSilent : orSteady;
+}
+
 Operator::Operator() {
 	chanData = 0;
 	freqMul = 0;
@@ -838,6 +853,108 @@ INLINE void Channel::GeneratePercussion( Chip* chip, Bit32s* output ) {
 	}
 }
 
+#if ( DBOPL_WAVE == WAVE_TABLEMUL )
+template<SynthMode mode, OperatorRender render0, OperatorRender render1>
+void Channel::GenerateTwoOp( Bit32u samples, Bit32s* output ) {
+	//Operators with a steady volume are rendered from local copies of their
+	//state, as the compiler can't tell the output doesn't alias them
+	Operator* op0 = Op( 0 );
+	Operator* op1 = Op( 1 );
+	const Bit16s* base0 = op0->waveBase;
+	const Bit16s* base1 = op1->waveBase;
+	const Bit32u mask0 = op0->waveMask;
+	const Bit32u mask1 = op1->waveMask;
+	const Bit32u add0 = op0->waveCurrent;
+	const Bit32u add1 = op1->waveCurrent;
+	const Bits mul0 = render0 == orSteady ? MulTable[ op0->SteadyVolume() >> ENV_EXTRA ] : 0;
+	const Bits mul1 = render1 == orSteady ? MulTable[ op1->SteadyVolume() >> ENV_EXTRA ] : 0;
+	Bit32u index0 = op0->waveIndex;
+	Bit32u index1 = op1->waveIndex;
+	Bit32s old0 = old[0];
+	Bit32s old1 = old[1];
+	const Bit8u shift = feedback;
+	const Bit32s left = maskLeft;
+	const Bit32s right = maskRight;
+
+	for ( Bitu i = 0; i < samples; i++ ) {
+		//Do unsigned shift so we can shift out all bits but still stay in 10 bit range otherwise
+		Bit32s mod = (Bit32u)((old0 + old1)) >> shift;
+		old0 = old1;
+		if ( render0 == orSilent ) {
+			old1 = 0;
+		} else if ( render0 == orSteady ) {
+			index0 += add0;
+			old1 = ( base0[ ( ( index0 >> WAVE_SH ) + mod ) & mask0 ] * mul0 ) >> MUL_SH;
+		} else {
+			old1 = op0->GetSample( mod );
+		}
+		Bit32s mod1 = ( mode == sm2AM || mode == sm3AM ) ? 0 : old0;
+		Bit32s sample;
+		if ( render1 == orSilent ) {
+			sample = 0;
+		} else if ( render1 == orSteady ) {
+			index1 += add1;
+			sample = ( base1[ ( ( index1 >> WAVE_SH ) + mod1 ) & mask1 ] * mul1 ) >> MUL_SH;
+		} else {
+			sample = op1->GetSample( mod1 );
+		}
+		if ( mode == sm2AM || mode == sm3AM )
+			sample += old0;
+		if ( mode == sm2AM || mode == sm2FM ) {
+			output[ i ] += sample;
+		} else {
+			output[ i * 2 + 0 ] += sample & left;
+			output[ i * 2 + 1 ] += sample & right;
+		}
+	}
+
+	old[0] = old0;
+	old[1] = old1;
+	//Silent operators simply forward the wave
+	if ( render0 == orSilent )
+		op0->waveIndex += add0 * samples;
+	else if ( render0 == orSteady )
+		op0->waveIndex = index0;
+	if ( render1 == orSilent )
+		op1->waveIndex += add1 * samples;
+	else if ( render1 == orSteady )
+		op1->waveIndex = index1;
+}
+
+template<SynthMode mode>
+void Channel::BlockTwoOp( Bit32u samples, Bit32s* output ) {
+	switch ( Op( 0 )->BlockRender() * 3 + Op( 1 )->BlockRender() ) {
+	case orSilent * 3 + orSilent:
+		GenerateTwoOp< mode, orSilent, orSilent >( samples, output );
+		break;
+	case orSilent * 3 + orSteady:
+		GenerateTwoOp< mode, orSilent, orSteady >( samples, output );
+		break;
+	case orSilent * 3 + orEnvelope:
+		GenerateTwoOp< mode, orSilent, orEnvelope >( samples, output );
+		break;
+	case orSteady * 3 + orSilent:
+		GenerateTwoOp< mode, orSteady, orSilent >( samples, output );
+		break;
+	case orSteady * 3 + orSteady:
+		GenerateTwoOp< mode, orSteady, orSteady >( samples, output );
+		break;
+	case orSteady * 3 + orEnvelope:
+		GenerateTwoOp< mode, orSteady, orEnvelope >( samples, output );
+		break;
+	case orEnvelope * 3 + orSilent:
+		GenerateTwoOp< mode, orEnvelope, orSilent >( samples, output );
+		break;
+	case orEnvelope * 3 + orSteady:
+		GenerateTwoOp< mode, orEnvelope, orSteady >( samples, output );
+		break;
+	default:
+		GenerateTwoOp< mode, orEnvelope, orEnvelope >( samples, output );
+		break;
+	}
+}
+#endif
+
 template<SynthMode mode>
 Channel* Channel::BlockTemplate( Chip* chip, Bit32u samples, Bit32s* output ) {
 	switch( mode ) {
@@ -911,6 +1028,13 @@ Channel* Channel::BlockTemplate( Chip* chip, Bit32u samples, Bit32s* output ) {
 		Op( 4 )->Prepare( chip );
 		Op( 5 )->Prepare( chip );
 	}
+#if ( DBOPL_WAVE == WAVE_TABLEMUL )
+	//Most music only uses 2 operator channels, render those per block
+	if ( ( mode == sm2AM || mode == sm2FM || mode == sm3AM || mode == sm3FM ) && !chip->referenceRender ) {
+		BlockTwoOp< mode >( samples, output );
+		return ( this + 1 );
+	}
+#endif
 	for ( Bitu i = 0; i < samples; i++ ) {
 		//Early out for percussion handlers
 		if ( mode == sm2Percussion ) {
@@ -1024,6 +1148,7 @@ Chip::Chip() {
 	regBD = 0;
 	reg104 = 0;
 	opl3Active = 0;
+	referenceRender = false;
 }
 
 INLINE Bit32u Chip::ForwardNoise() {
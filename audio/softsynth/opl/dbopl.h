@@ -85,6 +85,13 @@ typedef enum {
 	sm3Percussion
 } SynthMode;
 
+//How an operator is rendered for a whole block of samples
+typedef enum {
+	orSilent,
+	orSteady,
+	orEnvelope
+} OperatorRender;
+
 //Shifts for the values contained in chandata variable
 enum {
 	SHIFT_KSLBASE = 16,
@@ -178,6 +185,11 @@ public:
 
 	Bits GetSample( Bits modulation );
 	Bits GetWave( Bitu index, Bitu vol );
+
+	//Check if the envelope stays at the same volume for a whole block
+	bool Steady() const;
+	Bitu SteadyVolume() const;
+	OperatorRender BlockRender() const;
 public:
 	Operator();
 };
@@ -215,6 +227,11 @@ struct Channel {
 	//Generate blocks of data in specific modes
 	template<SynthMode mode>
 	Channel* BlockTemplate( Chip* chip, Bit32u samples, Bit32s* output );
+	//Generate blocks of 2 operator modes without going through the volume handlers
+	template<SynthMode mode>
+	void BlockTwoOp( Bit32u samples, Bit32s* output );
+	template<SynthMode mode, OperatorRender render0, OperatorRender render1>
+	void GenerateTwoOp( Bit32u samples, Bit32s* output );
 	Channel();
 };
 
@@ -253,6 +270,8 @@ struct Chip {
 	Bit8u waveFormMask;
 	//0 or -1 when enabled
 	Bit8s opl3Active;
+	//Always render through the volume handlers, used to verify the block renderer
+	bool referenceRender;
 
 	//Return the maximum amount of samples before and LFO change
 	Bit32u ForwardLFO( Bit32u samples );
@@ -29,6 +29,7 @@
 #include "backends/graphics/graphics.h"
 #include "common/config-manager.h"
 #include "common/textconsole.h"
+#include "common/util.h"
 
 // FIXME move joystick defines out and replace with confile file options
 // we should really allow users to map any key to a joystick button
@@ -381,6 +382,24 @@ bool SdlEventSource::pollEvent(Common::Event &event) {
 	return false;
 }
 
+bool SdlEventSource::waitForEvent(uint msecs) {
+	if (msecs == 0)
+		return true;
+
+#ifdef USE_SDL20
+	// Passing no event structure leaves the event in the queue.
+	SDL_WaitEventTimeout(NULL, msecs);
+#else
+	// SDL 1.2 has no way to wait for an event with a timeout. Polling the
+	// queue in short steps would wake up the CPU far more often than the
+	// engines used to, so sleep for at most 10ms, as they did before, and
+	// let the caller check for events in between.
+	g_system->delayMillis(MIN<uint>(msecs, 10));
+#endif
+
+	return true;
+}
+
 bool SdlEventSource::dispatchSDLEvent(SDL_Event &ev, Common::Event &event) {
 	switch (ev.type) {
 	case SDL_KEYDOWN:
@@ -44,6 +44,12 @@ public:
 	 */
 	virtual bool pollEvent(Common::Event &event);
 
+	/**
+	 * Waits for the next SDL event, or until the given time passed. SDL 1.2
+	 * can't wait for events, so there it only sleeps for up to 10ms.
+	 */
+	virtual bool waitForEvent(uint msecs);
+
 	/**
 	 * Resets keyboard emulation after a video screen change
 	 */
@@ -31,6 +31,7 @@
 #define FORBIDDEN_SYMBOL_EXCEPTION_exit		//Needed for IRIX's unistd.h
 
 #include "backends/fs/posix/posix-fs.h"
+#include "backends/fs/posix/posix-mmap-stream.h"
 #include "backends/fs/romfs/romfs-fs.h"
 #include "backends/fs/stdiostream.h"
 #include "common/algorithm.h"
@@ -250,10 +251,23 @@ AbstractFSNode *POSIXFilesystemNode::getParent() const {
 }
 
 Common::SeekableReadStream *POSIXFilesystemNode::createReadStream() {
+#if defined(POSIX)
+	// Large files are mapped into memory
+	Common::SeekableReadStream *stream = POSIXMmapStream::makeFromPath(getPath());
+	if (stream)
+		return stream;
+#endif
+
 	return StdioStream::makeFromPath(getPath(), false);
 }
 
 Common::WriteStream *POSIXFilesystemNode::createWriteStream() {
+#if defined(POSIX)
+	// The file may still be mapped by a read stream, which must not see it
+	// being truncated
+	POSIXMmapStream::unlinkMappedFile(getPath());
+#endif
+
 	return StdioStream::makeFromPath(getPath(), true);
 }
 
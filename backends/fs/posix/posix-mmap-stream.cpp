@@ -0,0 +1,160 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+
+#if defined(POSIX)
+
+// Disable symbol overrides so that we can use open, mmap etc.
+#define FORBIDDEN_SYMBOL_ALLOW_ALL
+
+#include "backends/fs/posix/posix-mmap-stream.h"
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+enum {
+	// Smaller files are read through stdio, mapping them isn't worth it
+	kMinMappedSize = 256 * 1024,
+	// Keep the address space usage of 32 bit systems in check
+	kMaxMappedSize32 = 64 * 1024 * 1024
+};
+
+POSIXMmapStream::MappingList POSIXMmapStream::_registry;
+
+Common::Mutex &POSIXMmapStream::getRegistryMutex() {
+	// Created on first use and never deleted, since a static mutex would
+	// be created before and destroyed after the backend
+	static Common::Mutex *mutex = 0;
+	if (!mutex)
+		mutex = new Common::Mutex();
+	return *mutex;
+}
+
+POSIXMmapStream::Mapping::Mapping(void *address, uint32 length, dev_t device, ino_t inode)
+	: _address(address), _length(length), _device(device), _inode(inode), _refCount(1) {
+	Common::StackLock lock(getRegistryMutex());
+	_registry.push_back(this);
+}
+
+POSIXMmapStream::Mapping::~Mapping() {
+	munmap(_address, _length);
+}
+
+void POSIXMmapStream::Mapping::ref() {
+	Common::StackLock lock(getRegistryMutex());
+	++_refCount;
+}
+
+void POSIXMmapStream::Mapping::unref() {
+	{
+		Common::StackLock lock(getRegistryMutex());
+		if (--_refCount > 0)
+			return;
+
+		_registry.remove(this);
+	}
+
+	// Nobody else can reach the mapping once the last reference is gone
+	delete this;
+}
+
+#if defined(_POSIX_MAPPED_FILES) && _POSIX_MAPPED_FILES > 0
+static bool isMappable(const struct stat &st) {
+	return S_ISREG(st.st_mode) && st.st_size >= kMinMappedSize && st.st_size <= 0x7FFFFFFF
+	       && (sizeof(void *) >= 8 || st.st_size <= kMaxMappedSize32);
+}
+#endif
+
+POSIXMmapStream *POSIXMmapStream::makeFromPath(const Common::String &path) {
+#if defined(_POSIX_MAPPED_FILES) && _POSIX_MAPPED_FILES > 0
+	int fd = open(path.c_str(), O_RDONLY);
+	if (fd < 0)
+		return 0;
+
+	struct stat st;
+	if (fstat(fd, &st) || !isMappable(st)) {
+		close(fd);
+		return 0;
+	}
+
+	const uint32 length = st.st_size;
+	void *address = mmap(0, length, PROT_READ, MAP_PRIVATE, fd, 0);
+
+	// The mapping stays valid after the descriptor is closed
+	close(fd);
+
+	if (address == MAP_FAILED)
+		return 0;
+
+	// The new stream takes over the initial reference
+	return new POSIXMmapStream(new Mapping(address, length, st.st_dev, st.st_ino), (const byte *)address, length);
+#else
+	return 0;
+#endif
+}
+
+void POSIXMmapStream::unlinkMappedFile(const Common::String &path) {
+#if defined(_POSIX_MAPPED_FILES) && _POSIX_MAPPED_FILES > 0
+	// Leave symbolic and hard links alone, unlinking would break them up.
+	// Neither unlink read only files, which opening for writing refuses.
+	struct stat st;
+	if (lstat(path.c_str(), &st) || st.st_nlink != 1 || !isMappable(st) || access(path.c_str(), W_OK))
+		return;
+
+	Common::StackLock lock(getRegistryMutex());
+	for (MappingList::const_iterator i = _registry.begin(); i != _registry.end(); ++i) {
+		if ((*i)->_device == st.st_dev && (*i)->_inode == st.st_ino) {
+			unlink(path.c_str());
+			return;
+		}
+	}
+#endif
+}
+
+POSIXMmapStream::POSIXMmapStream(Mapping *mapping, const byte *data, uint32 size)
+	: Common::MemoryReadStream(data, size), _mapping(mapping), _data(data) {
+}
+
+POSIXMmapStream::~POSIXMmapStream() {
+	_mapping->unref();
+}
+
+Common::SeekableReadStream *POSIXMmapStream::readStream(uint32 dataSize) {
+	const uint32 offset = pos();
+
+	if (dataSize > size() - offset) {
+		// Flag the end of the stream, like a short read() does
+		dataSize = size() - offset;
+		seek(0, SEEK_END);
+		readByte();
+	} else {
+		skip(dataSize);
+	}
+	assert(dataSize > 0);
+
+	_mapping->ref();
+	return new POSIXMmapStream(_mapping, _data + offset, dataSize);
+}
+
+#endif
@@ -0,0 +1,103 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+
+#ifndef BACKENDS_FS_POSIX_MMAP_STREAM_H
+#define BACKENDS_FS_POSIX_MMAP_STREAM_H
+
+#include "common/list.h"
+#include "common/memstream.h"
+#include "common/mutex.h"
+#include "common/str.h"
+
+#include <sys/types.h>
+
+/**
+ * Read only stream on a file which is mapped into memory. Reads are served
+ * straight from the mapping, and readStream() returns streams sharing the
+ * mapping instead of copies of the data. The mapping is released when the
+ * last of these streams is deleted. Its reference count is protected by a
+ * mutex, as such streams are commonly handed to the mixer and deleted on
+ * the audio thread while the engine creates new ones from the same file.
+ *
+ * Accessing a part of a mapping which is no longer backed by the file
+ * raises SIGBUS. To avoid that for files ScummVM writes itself, like save
+ * files, POSIXFilesystemNode::createWriteStream() replaces a file which is
+ * currently mapped instead of truncating it (see unlinkMappedFile()). All
+ * live mappings are kept in a registry for this. Files truncated by other
+ * programs while they are open are not handled.
+ */
+class POSIXMmapStream : public Common::MemoryReadStream {
+public:
+	/**
+	 * Map the file at the given path into memory. Returns 0 if the file is
+	 * too small to be worth mapping, too large for the address space, or
+	 * can't be mapped at all, in which case a regular stream should be
+	 * used instead.
+	 */
+	static POSIXMmapStream *makeFromPath(const Common::String &path);
+
+	/**
+	 * Unlink the file at the given path if it is currently mapped, so that
+	 * it is recreated rather than truncated when it is opened for writing.
+	 * Existing mappings keep referring to the old contents then. Files
+	 * which are not mapped are left alone, so they keep their permissions,
+	 * ownership and extended attributes.
+	 */
+	static void unlinkMappedFile(const Common::String &path);
+
+	~POSIXMmapStream();
+
+	virtual Common::SeekableReadStream *readStream(uint32 dataSize);
+
+private:
+	/**
+	 * A mapped file. Mappings are listed in the registry from their
+	 * creation until their last reference is gone.
+	 */
+	struct Mapping {
+		Mapping(void *address, uint32 length, dev_t device, ino_t inode);
+		~Mapping();
+
+		void ref();
+		void unref();
+
+		void *_address;
+		uint32 _length;
+		dev_t _device;
+		ino_t _inode;
+		int _refCount;
+	};
+
+	typedef Common::List<Mapping *> MappingList;
+
+	/** The registry of live mappings, protected by getRegistryMutex(). */
+	static MappingList _registry;
+	static Common::Mutex &getRegistryMutex();
+
+	POSIXMmapStream(Mapping *mapping, const byte *data, uint32 size);
+
+	Mapping *_mapping;
+	const byte *_data;
+};
+
+#endif
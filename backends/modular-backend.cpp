@@ -241,6 +241,20 @@ void ModularBackend::displayMessageOnOSD(const char *msg) {
 	_graphicsManager->displayMessageOnOSD(msg);
 }
 
+void ModularBackend::waitForEvent(uint msecs) {
+#ifdef ENABLE_EVENTRECORDER
+	// Events come from the recording during playback, and delayMillis
+	// knows how to deal with fast playback.
+	if (g_eventRec.processDelayMillis()) {
+		delayMillis(msecs);
+		return;
+	}
+#endif
+
+	if (!getDefaultEventSource()->waitForEvent(msecs))
+		delayMillis(msecs);
+}
+
 void ModularBackend::quit() {
 	exit(0);
 }
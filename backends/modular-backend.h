@@ -122,6 +122,13 @@ public:
 
 	//@}
 
+	/** @name Events and Time */
+	//@{
+
+	virtual void waitForEvent(uint msecs);
+
+	//@}
+
 	/** @name Miscellaneous */
 	//@{
 
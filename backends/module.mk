@@ -16,6 +16,7 @@ MODULE_OBJS := \
 	midi/timidity.o \
 	saves/savefile.o \
 	saves/default/default-saves.o \
+	saves/default/async-savefile.o \
 	timer/default/default-timer.o
 
 
@@ -95,6 +96,7 @@ ifdef POSIX
 MODULE_OBJS += \
 	fs/posix/posix-fs.o \
 	fs/posix/posix-fs-factory.o \
+	fs/posix/posix-mmap-stream.o \
 	fs/romfs/romfs-fs.o \
 	fs/romfs/romfsstream.o \
 	plugins/posix/posix-provider.o \
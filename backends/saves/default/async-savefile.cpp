@@ -0,0 +1,174 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#include "common/scummsys.h"
+
+#if !defined(DISABLE_DEFAULT_SAVEFILEMANAGER)
+
+#include "backends/saves/default/async-savefile.h"
+#include "backends/saves/default/default-saves.h"
+
+#include "common/system.h"
+#include "common/util.h"
+#include "common/zlib.h"
+
+AsyncSaveJob::AsyncSaveJob(const Common::String &name, Common::WriteStream *sink)
+	: _name(name), _sink(Common::wrapCompressedWriteStream(sink)),
+	  _closed(false), _error(false), _done(false) {
+	assert(sink);
+}
+
+AsyncSaveJob::~AsyncSaveJob() {
+	for (SliceList::iterator i = _pending.begin(); i != _pending.end(); ++i)
+		delete *i;
+}
+
+void AsyncSaveJob::queueSlice(Slice *slice) {
+	Common::StackLock lock(_mutex);
+	assert(!_closed);
+	_pending.push_back(slice);
+}
+
+void AsyncSaveJob::close() {
+	Common::StackLock lock(_mutex);
+	_closed = true;
+}
+
+bool AsyncSaveJob::hasError() const {
+	Common::StackLock lock(_mutex);
+	return _error;
+}
+
+bool AsyncSaveJob::process(uint32 timeLimit) {
+	if (_done)
+		return true;
+
+	// Avoid querying the time without a limit, which is also used while
+	// the backend shuts down.
+	const uint32 start = (timeLimit != kNoTimeLimit) ? g_system->getMillis() : 0;
+
+	for (;;) {
+		Slice *slice = 0;
+		bool finished = false;
+		bool error;
+		{
+			Common::StackLock lock(_mutex);
+			if (!_pending.empty()) {
+				slice = _pending.front();
+				_pending.pop_front();
+			} else {
+				finished = _closed;
+			}
+			error = _error;
+		}
+
+		if (slice) {
+			// Data after a write error is dropped, the file is broken anyway
+			if (!error && (_sink->write(slice->data, slice->size) != slice->size || _sink->err())) {
+				Common::StackLock lock(_mutex);
+				_error = true;
+			}
+			delete slice;
+		} else if (finished) {
+			_sink->finalize();
+			if (_sink->err()) {
+				Common::StackLock lock(_mutex);
+				_error = true;
+			}
+
+			// Close the file now, so it can be opened again
+			_sink.reset();
+			_done = true;
+			return true;
+		} else {
+			// Wait for the engine to write more
+			return false;
+		}
+
+		if (timeLimit != kNoTimeLimit && g_system->getMillis() - start >= timeLimit)
+			return false;
+	}
+}
+
+AsyncCompressedSaveFile::AsyncCompressedSaveFile(DefaultSaveFileManager *manager, AsyncSaveJob *job)
+	: _manager(manager), _job(job), _current(0), _writeError(false) {
+	assert(manager);
+	assert(job);
+}
+
+AsyncCompressedSaveFile::~AsyncCompressedSaveFile() {
+	finalize();
+	delete _current;
+}
+
+uint32 AsyncCompressedSaveFile::write(const void *dataPtr, uint32 dataSize) {
+	if (!_job || err())
+		return 0;
+
+	const byte *src = (const byte *)dataPtr;
+	uint32 left = dataSize;
+
+	while (left > 0) {
+		if (!_current) {
+			_current = new AsyncSaveJob::Slice;
+			_current->size = 0;
+		}
+
+		const uint32 chunk = MIN<uint32>(left, AsyncSaveJob::kSliceSize - _current->size);
+		memcpy(_current->data + _current->size, src, chunk);
+		_current->size += chunk;
+		src += chunk;
+		left -= chunk;
+
+		if (_current->size == AsyncSaveJob::kSliceSize) {
+			_job->queueSlice(_current);
+			_current = 0;
+		}
+	}
+
+	return dataSize;
+}
+
+bool AsyncCompressedSaveFile::err() const {
+	return _job ? _job->hasError() : _writeError;
+}
+
+void AsyncCompressedSaveFile::clearErr() {
+	// Write errors are not recoverable, just like in the wrapped stream.
+}
+
+void AsyncCompressedSaveFile::finalize() {
+	if (!_job)
+		return;
+
+	if (_current && _current->size > 0) {
+		_job->queueSlice(_current);
+		_current = 0;
+	}
+
+	// Finish writing right away, so err() reports whether the savefile
+	// really made it to the disk. The job is deleted by the manager.
+	_writeError = !_manager->finishAsyncSave(_job);
+	_job = 0;
+}
+
+#endif // !defined(DISABLE_DEFAULT_SAVEFILEMANAGER)
@@ -0,0 +1,141 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#if !defined(BACKEND_SAVES_ASYNC_SAVEFILE_H) && !defined(DISABLE_DEFAULT_SAVEFILEMANAGER)
+#define BACKEND_SAVES_ASYNC_SAVEFILE_H
+
+#include "common/scummsys.h"
+#include "common/savefile.h"
+#include "common/list.h"
+#include "common/mutex.h"
+#include "common/ptr.h"
+#include "common/str.h"
+
+class DefaultSaveFileManager;
+
+/**
+ * The background part of a save file written by AsyncCompressedSaveFile.
+ *
+ * It holds the slices of data written by the engine until they are
+ * compressed and written. Jobs are owned by the DefaultSaveFileManager,
+ * which processes them from a timer proc while the engine is serializing,
+ * and finishes and deletes them when the save file is finalized.
+ */
+class AsyncSaveJob {
+public:
+	enum {
+		kSliceSize = 64 * 1024,
+		kNoTimeLimit = 0xFFFFFFFF
+	};
+
+	struct Slice {
+		byte data[kSliceSize];
+		uint32 size;
+	};
+
+	/**
+	 * @param name	the name of the save file
+	 * @param sink	the stream the data is finally written to; it is
+	 *				wrapped in a compressing stream and owned by the job
+	 */
+	AsyncSaveJob(const Common::String &name, Common::WriteStream *sink);
+	~AsyncSaveJob();
+
+	const Common::String &getName() const { return _name; }
+
+	/** Queue a slice to be written. Called by the save file. */
+	void queueSlice(Slice *slice);
+
+	/** Mark that no more slices will be queued. Called by the save file. */
+	void close();
+
+	/** Return whether writing the data failed so far. */
+	bool hasError() const;
+
+	/**
+	 * Compress and write pending slices until none are left or the given
+	 * amount of time has been spent. Once the job is closed and all slices
+	 * have been written, the compressed stream is finalized. Calls must be
+	 * serialized by the caller.
+	 *
+	 * @param timeLimit	the time budget in milliseconds, or kNoTimeLimit
+	 * @return true if the job is done
+	 */
+	bool process(uint32 timeLimit);
+
+private:
+	typedef Common::List<Slice *> SliceList;
+
+	const Common::String _name;
+	Common::ScopedPtr<Common::WriteStream> _sink;
+
+	/** Protects _pending, _closed and _error. */
+	Common::Mutex _mutex;
+	SliceList _pending;
+	bool _closed;
+	bool _error;
+
+	/** Only touched by process(). */
+	bool _done;
+};
+
+/**
+ * An OutSaveFile which compresses and writes its data in the background.
+ *
+ * Data written by the engine is collected into fixed size slices, which
+ * are handed to an AsyncSaveJob. The job compresses them with the stream
+ * from Common::wrapCompressedWriteStream from the timer thread, so the
+ * engine only pays for a memcpy while it serializes its state. The
+ * resulting file is identical to one written synchronously.
+ *
+ * finalize() compresses and writes whatever the timer did not get to yet,
+ * so err() reports the result of the whole write afterwards, as engines
+ * expect.
+ */
+class AsyncCompressedSaveFile : public Common::OutSaveFile {
+public:
+	/**
+	 * @param manager	the savefile manager owning the job
+	 * @param job		the job writing the data in the background
+	 */
+	AsyncCompressedSaveFile(DefaultSaveFileManager *manager, AsyncSaveJob *job);
+	~AsyncCompressedSaveFile();
+
+	virtual uint32 write(const void *dataPtr, uint32 dataSize);
+	virtual bool err() const;
+	virtual void clearErr();
+	virtual void finalize();
+
+private:
+	DefaultSaveFileManager *_manager;
+
+	/** The job, until it is finished by finalize(). */
+	AsyncSaveJob *_job;
+
+	/** The slice currently filled by write(). */
+	AsyncSaveJob::Slice *_current;
+
+	/** Whether writing the data failed, once finalize() has been called. */
+	bool _writeError;
+};
+
+#endif
@@ -25,25 +25,49 @@
 #if !defined(DISABLE_DEFAULT_SAVEFILEMANAGER)
 
 #include "backends/saves/default/default-saves.h"
+#include "backends/saves/default/async-savefile.h"
 
 #include "common/savefile.h"
+#include "common/algorithm.h"
 #include "common/util.h"
 #include "common/fs.h"
 #include "common/archive.h"
 #include "common/config-manager.h"
+#include "common/system.h"
+#include "common/timer.h"
 #include "common/zlib.h"
 
 #ifndef _WIN32_WCE
 #include <errno.h>	// for removeSavefile()
 #endif
 
-DefaultSaveFileManager::DefaultSaveFileManager() {
+DefaultSaveFileManager::DefaultSaveFileManager() : _asyncSaveTimerInstalled(false) {
 }
 
-DefaultSaveFileManager::DefaultSaveFileManager(const Common::String &defaultSavepath) {
+DefaultSaveFileManager::DefaultSaveFileManager(const Common::String &defaultSavepath) : _asyncSaveTimerInstalled(false) {
 	ConfMan.registerDefault("savepath", defaultSavepath);
 }
 
+DefaultSaveFileManager::~DefaultSaveFileManager() {
+	// Some backends delete the timer manager first, in which case the timer
+	// proc can not run anymore anyway.
+	Common::TimerManager *timerManager = g_system->getTimerManager();
+	if (_asyncSaveTimerInstalled && timerManager)
+		timerManager->removeTimerProc(asyncSaveTimerProc);
+
+	// Savefiles still open at this point are finished as they are, so no
+	// data is lost.
+	Common::StackLock lock(_asyncSaveMutex);
+	for (AsyncSaveJobList::iterator i = _asyncSaveJobs.begin(); i != _asyncSaveJobs.end(); ++i) {
+		(*i)->close();
+		(*i)->process(AsyncSaveJob::kNoTimeLimit);
+		if ((*i)->hasError())
+			warning("Failed to write savefile '%s'", (*i)->getName().c_str());
+		delete *i;
+	}
+	_asyncSaveJobs.clear();
+}
+
 
 void DefaultSaveFileManager::checkPath(const Common::FSNode &dir) {
 	clearError();
@@ -55,6 +79,9 @@ void DefaultSaveFileManager::checkPath(const Common::FSNode &dir) {
 }
 
 Common::StringArray DefaultSaveFileManager::listSavefiles(const Common::String &pattern) {
+	// Savefiles which have not been created yet would be missing otherwise
+	waitForAsyncSave(Common::String());
+
 	Common::String savePathName = getSavePath();
 	checkPath(Common::FSNode(savePathName));
 	if (getError().getCode() != Common::kNoError)
@@ -87,6 +114,8 @@ Common::InSaveFile *DefaultSaveFileManager::openForLoading(const Common::String
 	// recreate FSNode since checkPath may have changed/created the directory
 	Common::FSNode savePath(savePathName);
 
+	waitForAsyncSave(filename);
+
 	Common::FSNode file = savePath.getChild(filename);
 	if (!file.exists())
 		return 0;
@@ -107,12 +136,21 @@ Common::OutSaveFile *DefaultSaveFileManager::openForSaving(const Common::String
 	// recreate FSNode since checkPath may have changed/created the directory
 	Common::FSNode savePath(savePathName);
 
+	// Do not let an older save of the same name overwrite this one
+	waitForAsyncSave(filename);
+	forgetFailedAsyncSave(filename);
+
 	Common::FSNode file = savePath.getChild(filename);
 
 	// Open the file for saving
 	Common::WriteStream *sf = file.createWriteStream();
 
-	return compress ? Common::wrapCompressedWriteStream(sf) : sf;
+	if (!sf || !compress)
+		return sf;
+
+	// Compress the data in the background, so serializing large games does
+	// not stall the engine while zlib is busy.
+	return createAsyncSaveFile(filename, sf);
 }
 
 bool DefaultSaveFileManager::removeSavefile(const Common::String &filename) {
@@ -124,6 +162,9 @@ bool DefaultSaveFileManager::removeSavefile(const Common::String &filename) {
 	// recreate FSNode since checkPath may have changed/created the directory
 	Common::FSNode savePath(savePathName);
 
+	waitForAsyncSave(filename);
+	forgetFailedAsyncSave(filename);
+
 	Common::FSNode file = savePath.getChild(filename);
 
 	// FIXME: remove does not exist on all systems. If your port fails to
@@ -143,6 +184,130 @@ bool DefaultSaveFileManager::removeSavefile(const Common::String &filename) {
 	}
 }
 
+Common::SaveFileManager::SaveStatus DefaultSaveFileManager::getSaveStatus(const Common::String &filename, bool wait) {
+	if (wait)
+		waitForAsyncSave(filename);
+	else
+		updateAsyncSaveTimer();
+
+	Common::StackLock lock(_asyncSaveMutex);
+	for (AsyncSaveJobList::const_iterator i = _asyncSaveJobs.begin(); i != _asyncSaveJobs.end(); ++i) {
+		if ((*i)->getName() == filename)
+			return kSaveInProgress;
+	}
+
+	if (Common::find(_failedAsyncSaves.begin(), _failedAsyncSaves.end(), filename) != _failedAsyncSaves.end())
+		return kSaveFailed;
+
+	return kSaveComplete;
+}
+
+void DefaultSaveFileManager::waitForAsyncSave(const Common::String &filename) {
+	{
+		Common::StackLock lock(_asyncSaveMutex);
+
+		// Holding the lock keeps the timer proc from processing the same
+		// job concurrently.
+		AsyncSaveJobList::iterator i = _asyncSaveJobs.begin();
+		while (i != _asyncSaveJobs.end()) {
+			if ((filename.empty() || (*i)->getName() == filename) && (*i)->process(AsyncSaveJob::kNoTimeLimit))
+				i = finishAsyncSaveJob(i);
+			else
+				++i;
+		}
+	}
+
+	updateAsyncSaveTimer();
+}
+
+Common::OutSaveFile *DefaultSaveFileManager::createAsyncSaveFile(const Common::String &filename, Common::WriteStream *sink) {
+	AsyncSaveJob *job = new AsyncSaveJob(filename, sink);
+	{
+		Common::StackLock lock(_asyncSaveMutex);
+		_asyncSaveJobs.push_back(job);
+	}
+
+	// The timer manager is only touched outside of our lock, since the
+	// timer proc acquires it while the timer manager holds its own lock.
+	if (!_asyncSaveTimerInstalled)
+		_asyncSaveTimerInstalled = g_system->getTimerManager()->installTimerProc(asyncSaveTimerProc, 10000, this, "DefaultSaveFileManager");
+
+	// Without a timer, everything is written once the savefile is finished
+	// with, i.e. by the next call to the savefile manager.
+	if (!_asyncSaveTimerInstalled)
+		warning("Failed to install the timer for writing savefiles in the background");
+
+	return new AsyncCompressedSaveFile(this, job);
+}
+
+bool DefaultSaveFileManager::finishAsyncSave(AsyncSaveJob *job) {
+	bool success;
+	{
+		// Holding the lock keeps the timer proc away from the job. It never
+		// deletes jobs which are not closed, so the job is still listed.
+		Common::StackLock lock(_asyncSaveMutex);
+		job->close();
+		job->process(AsyncSaveJob::kNoTimeLimit);
+		success = !job->hasError();
+		finishAsyncSaveJob(Common::find(_asyncSaveJobs.begin(), _asyncSaveJobs.end(), job));
+	}
+
+	updateAsyncSaveTimer();
+	return success;
+}
+
+void DefaultSaveFileManager::updateAsyncSaveTimer() {
+	if (!_asyncSaveTimerInstalled)
+		return;
+
+	{
+		Common::StackLock lock(_asyncSaveMutex);
+		if (!_asyncSaveJobs.empty())
+			return;
+	}
+
+	// Only the engine thread adds jobs, so the list stays empty here.
+	g_system->getTimerManager()->removeTimerProc(asyncSaveTimerProc);
+	_asyncSaveTimerInstalled = false;
+}
+
+void DefaultSaveFileManager::forgetFailedAsyncSave(const Common::String &filename) {
+	Common::StackLock lock(_asyncSaveMutex);
+	_failedAsyncSaves.remove(filename);
+}
+
+DefaultSaveFileManager::AsyncSaveJobList::iterator DefaultSaveFileManager::finishAsyncSaveJob(AsyncSaveJobList::iterator job) {
+	if ((*job)->hasError()) {
+		warning("Failed to write savefile '%s'", (*job)->getName().c_str());
+		_failedAsyncSaves.push_back((*job)->getName());
+	}
+
+	delete *job;
+	return _asyncSaveJobs.erase(job);
+}
+
+void DefaultSaveFileManager::asyncSaveTimerProc(void *refCon) {
+	DefaultSaveFileManager *manager = (DefaultSaveFileManager *)refCon;
+	Common::StackLock lock(manager->_asyncSaveMutex);
+
+	// Spend at most a few milliseconds per tick, so other timers (e.g.
+	// music) are not delayed noticeably. Finished jobs are deleted right
+	// away, but the timer proc can not remove itself; this is done by the
+	// engine thread the next time it uses the savefile manager.
+	const uint32 start = g_system->getMillis();
+	AsyncSaveJobList::iterator i = manager->_asyncSaveJobs.begin();
+	while (i != manager->_asyncSaveJobs.end()) {
+		const uint32 elapsed = g_system->getMillis() - start;
+		if (elapsed >= 4)
+			break;
+
+		if ((*i)->process(4 - elapsed))
+			i = manager->finishAsyncSaveJob(i);
+		else
+			++i;
+	}
+}
+
 Common::String DefaultSaveFileManager::getSavePath() const {
 
 	Common::String dir;
@@ -27,6 +27,10 @@
 #include "common/savefile.h"
 #include "common/str.h"
 #include "common/fs.h"
+#include "common/list.h"
+#include "common/mutex.h"
+
+class AsyncSaveJob;
 
 /**
  * Provides a default savefile manager implementation for common platforms.
@@ -35,11 +39,13 @@ class DefaultSaveFileManager : public Common::SaveFileManager {
 public:
 	DefaultSaveFileManager();
 	DefaultSaveFileManager(const Common::String &defaultSavepath);
+	virtual ~DefaultSaveFileManager();
 
 	virtual Common::StringArray listSavefiles(const Common::String &pattern);
 	virtual Common::InSaveFile *openForLoading(const Common::String &filename);
 	virtual Common::OutSaveFile *openForSaving(const Common::String &filename, bool compress = true);
 	virtual bool removeSavefile(const Common::String &filename);
+	virtual SaveStatus getSaveStatus(const Common::String &filename, bool wait = false);
 
 protected:
 	/**
@@ -54,6 +60,65 @@ protected:
 	 * Sets the internal error and error message accordingly.
 	 */
 	virtual void checkPath(const Common::FSNode &dir);
+
+	/**
+	 * Finish writing the given savefile, if it is still being compressed in
+	 * the background. Should be called before accessing the file on disk.
+	 * An empty name finishes all savefiles. Must only be called from the
+	 * engine thread.
+	 */
+	void waitForAsyncSave(const Common::String &filename);
+
+private:
+	typedef Common::List<AsyncSaveJob *> AsyncSaveJobList;
+
+	/**
+	 * Savefiles which are still compressed and written in the background.
+	 * Protected by _asyncSaveMutex.
+	 */
+	AsyncSaveJobList _asyncSaveJobs;
+
+	/**
+	 * Names of the savefiles which failed to be written in the background.
+	 * Protected by _asyncSaveMutex.
+	 */
+	Common::List<Common::String> _failedAsyncSaves;
+
+	Common::Mutex _asyncSaveMutex;
+
+	/**
+	 * Whether asyncSaveTimerProc is installed. Only accessed from the
+	 * engine thread, since the timer proc can not remove itself.
+	 */
+	bool _asyncSaveTimerInstalled;
+
+	friend class AsyncCompressedSaveFile;
+
+	/**
+	 * Write the rest of the given job and delete it. Called when its
+	 * savefile is finalized.
+	 *
+	 * @return false if writing the savefile failed
+	 */
+	bool finishAsyncSave(AsyncSaveJob *job);
+
+	/** Start writing a savefile in the background. */
+	Common::OutSaveFile *createAsyncSaveFile(const Common::String &filename, Common::WriteStream *sink);
+
+	/** Stop reporting the given savefile as failed. */
+	void forgetFailedAsyncSave(const Common::String &filename);
+
+	/** Remove the timer proc if there is nothing left to do for it. */
+	void updateAsyncSaveTimer();
+
+	/**
+	 * Delete the given finished job, and remember it if it failed.
+	 * Must be called with _asyncSaveMutex held.
+	 */
+	AsyncSaveJobList::iterator finishAsyncSaveJob(AsyncSaveJobList::iterator job);
+
+	/** Timer callback compressing pending data of all async savefiles. */
+	static void asyncSaveTimerProc(void *refCon);
 };
 
 #endif
@@ -84,6 +84,20 @@ POSIXSaveFileManager::POSIXSaveFileManager() {
 #endif
 }
 
+bool POSIXSaveFileManager::getSavefileInfo(const Common::String &name, uint32 &size, uint32 &modifiedTime) {
+	waitForAsyncSave(name);
+
+	const Common::String path = Common::FSNode(getSavePath()).getChild(name).getPath();
+
+	struct stat sb;
+	if (stat(path.c_str(), &sb) != 0 || !S_ISREG(sb.st_mode))
+		return false;
+
+	size = sb.st_size;
+	modifiedTime = sb.st_mtime;
+	return true;
+}
+
 void POSIXSaveFileManager::checkPath(const Common::FSNode &dir) {
 	const Common::String path = dir.getPath();
 	clearError();
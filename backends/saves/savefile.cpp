@@ -59,6 +59,11 @@ bool SaveFileManager::copySavefile(const String &oldFilename, const String &newF
 		free(buffer);
 		delete outFile;
 		delete inFile;
+
+		// The copy may still be written in the background, and callers
+		// like renameSavefile need to know whether it succeeded.
+		if (success)
+			success = getSaveStatus(newFilename, true) == kSaveComplete;
 	}
 
 	return success;
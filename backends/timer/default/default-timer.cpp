@@ -24,6 +24,8 @@
 #include "backends/timer/default/default-timer.h"
 #include "common/util.h"
 #include "common/system.h"
+#include "common/debug.h"
+#include "common/textconsole.h"
 
 struct TimerSlot {
 	Common::TimerManager::TimerProc callback;
@@ -33,61 +35,109 @@ struct TimerSlot {
 
 	uint32 nextFireTime;	// in milliseconds
 	uint32 nextFireTimeMicro;	// microseconds part of nextFire
-
-	TimerSlot *next;
+	uint32 sequence;	// order in which the slots were queued
+
+	// Scheduling statistics, printed on debug level 2 on destruction
+	uint32 lastCallTime;	// in milliseconds
+	uint32 calls;
+	uint32 totalLatency;
+	uint32 maxLatency;
+	uint32 totalJitter;
+	uint32 maxJitter;
+
+	bool isDueBefore(const TimerSlot *other) const {
+		// Slots due in the same millisecond fire in the order they were
+		// queued, like they always did.
+		if (nextFireTime != other->nextFireTime)
+			return nextFireTime < other->nextFireTime;
+		return (int32)(sequence - other->sequence) < 0;
+	}
 };
 
-void insertPrioQueue(TimerSlot *head, TimerSlot *newSlot) {
-	// The head points to a fake anchor TimerSlot; this common
-	// trick allows us to get rid of many special cases.
+void DefaultTimerManager::heapPush(TimerSlot *slot) {
+	slot->sequence = _nextSequence++;
+	_queue.push_back(slot);
+
+	// Move the new slot up until its parent is due before it.
+	uint pos = _queue.size() - 1;
+	while (pos > 0) {
+		const uint parent = (pos - 1) / 2;
+		if (!slot->isDueBefore(_queue[parent]))
+			break;
+		_queue[pos] = _queue[parent];
+		pos = parent;
+	}
+	_queue[pos] = slot;
+}
 
-	const uint32 nextFireTime = newSlot->nextFireTime;
-	TimerSlot *slot = head;
-	newSlot->next = 0;
+TimerSlot *DefaultTimerManager::heapPop() {
+	assert(!_queue.empty());
 
-	// Insert the new slot into the sorted list of already scheduled
-	// timers in such a way that the list stays sorted...
-	while (true) {
-		assert(slot);
-		if (slot->next == 0 || nextFireTime < slot->next->nextFireTime) {
-			newSlot->next = slot->next;
-			slot->next = newSlot;
-			return;
-		}
-		slot = slot->next;
-	}
+	TimerSlot *top = _queue[0];
+	_queue[0] = _queue.back();
+	_queue.pop_back();
+	if (!_queue.empty())
+		heapSiftDown(0);
+	return top;
 }
 
+void DefaultTimerManager::heapSiftDown(uint pos) {
+	TimerSlot *slot = _queue[pos];
+	const uint size = _queue.size();
 
-DefaultTimerManager::DefaultTimerManager() :
-	_head(0) {
+	// Move the slot down until both its children are due after it.
+	while (true) {
+		uint child = 2 * pos + 1;
+		if (child >= size)
+			break;
+		if (child + 1 < size && _queue[child + 1]->isDueBefore(_queue[child]))
+			++child;
+		if (!_queue[child]->isDueBefore(slot))
+			break;
+		_queue[pos] = _queue[child];
+		pos = child;
+	}
+	_queue[pos] = slot;
+}
 
-	_head = new TimerSlot();
-	memset(_head, 0, sizeof(TimerSlot));
+DefaultTimerManager::DefaultTimerManager() : _nextSequence(0) {
 }
 
 DefaultTimerManager::~DefaultTimerManager() {
 	Common::StackLock lock(_mutex);
 
-	TimerSlot *slot = _head;
-	while (slot) {
-		TimerSlot *next = slot->next;
+	for (TimerQueue::iterator i = _queue.begin(); i != _queue.end(); ++i) {
+		TimerSlot *slot = *i;
+		// Jitter is measured between two calls, so there is one sample less
+		if (slot->calls)
+			debug(2, "Timer '%s': %u calls, latency avg %u ms max %u ms, jitter avg %u ms max %u ms",
+			      slot->id.c_str(), slot->calls, slot->totalLatency / slot->calls, slot->maxLatency,
+			      slot->calls > 1 ? slot->totalJitter / (slot->calls - 1) : 0, slot->maxJitter);
 		delete slot;
-		slot = next;
 	}
-	_head = 0;
+	_queue.clear();
 }
 
-void DefaultTimerManager::handler() {
+uint32 DefaultTimerManager::handler(uint32 maxDelay) {
 	Common::StackLock lock(_mutex);
 
 	uint32 curTime = g_system->getMillis(true);
 
 	// Repeat as long as there is a TimerSlot that is scheduled to fire.
-	TimerSlot *slot = _head->next;
-	while (slot && slot->nextFireTime < curTime) {
-		// Remove the slot from the priority queue
-		_head->next = slot->next;
+	while (!_queue.empty() && _queue[0]->nextFireTime <= curTime) {
+		TimerSlot *slot = heapPop();
+
+		// Update the statistics
+		const uint32 latency = curTime - slot->nextFireTime;
+		slot->totalLatency += latency;
+		slot->maxLatency = MAX(slot->maxLatency, latency);
+		if (slot->calls) {
+			const int32 jitter = (int32)(curTime - slot->lastCallTime) - (int32)(slot->interval / 1000);
+			slot->totalJitter += ABS(jitter);
+			slot->maxJitter = MAX<uint32>(slot->maxJitter, ABS(jitter));
+		}
+		slot->lastCallTime = curTime;
+		++slot->calls;
 
 		// Update the fire time and reinsert the TimerSlot into the priority
 		// queue.
@@ -98,15 +148,21 @@ void DefaultTimerManager::handler() {
 			slot->nextFireTime += slot->nextFireTimeMicro / 1000;
 			slot->nextFireTimeMicro %= 1000;
 		}
-		insertPrioQueue(_head, slot);
+		heapPush(slot);
 
 		// Invoke the timer callback
 		assert(slot->callback);
 		slot->callback(slot->refCon);
-
-		// Look at the next scheduled timer
-		slot = _head->next;
 	}
+
+	if (_queue.empty())
+		return maxDelay;
+
+	// Callbacks may have taken a while, so check the time again.
+	curTime = g_system->getMillis(true);
+	if (_queue[0]->nextFireTime <= curTime)
+		return 0;
+	return MIN(_queue[0]->nextFireTime - curTime, maxDelay);
 }
 
 bool DefaultTimerManager::installTimerProc(TimerProc callback, int32 interval, void *refCon, const Common::String &id) {
@@ -134,9 +190,14 @@ bool DefaultTimerManager::installTimerProc(TimerProc callback, int32 interval, v
 	slot->interval = interval;
 	slot->nextFireTime = g_system->getMillis() + interval / 1000;
 	slot->nextFireTimeMicro = interval % 1000;
-	slot->next = 0;
+	slot->lastCallTime = 0;
+	slot->calls = 0;
+	slot->totalLatency = 0;
+	slot->maxLatency = 0;
+	slot->totalJitter = 0;
+	slot->maxJitter = 0;
 
-	insertPrioQueue(_head, slot);
+	heapPush(slot);
 
 	return true;
 }
@@ -144,17 +205,19 @@ bool DefaultTimerManager::installTimerProc(TimerProc callback, int32 interval, v
 void DefaultTimerManager::removeTimerProc(TimerProc callback) {
 	Common::StackLock lock(_mutex);
 
-	TimerSlot *slot = _head;
-
-	while (slot->next) {
-		if (slot->next->callback == callback) {
-			TimerSlot *next = slot->next->next;
-			delete slot->next;
-			slot->next = next;
-		} else {
-			slot = slot->next;
-		}
+	// Remove all slots using the callback and restore the heap property
+	// afterwards.
+	uint kept = 0;
+	for (uint i = 0; i < _queue.size(); ++i) {
+		if (_queue[i]->callback == callback)
+			delete _queue[i];
+		else
+			_queue[kept++] = _queue[i];
 	}
+	_queue.resize(kept);
+
+	for (uint i = kept / 2; i-- > 0; )
+		heapSiftDown(i);
 
 	// We need to remove all names referencing the timer proc here.
 	//
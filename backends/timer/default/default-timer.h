@@ -24,6 +24,7 @@
 #define BACKENDS_TIMER_DEFAULT_H
 
 #include "common/str.h"
+#include "common/array.h"
 #include "common/hash-str.h"
 #include "common/timer.h"
 #include "common/mutex.h"
@@ -33,11 +34,25 @@ struct TimerSlot;
 class DefaultTimerManager : public Common::TimerManager {
 private:
 	typedef Common::HashMap<Common::String, TimerProc, Common::IgnoreCase_Hash, Common::IgnoreCase_EqualTo> TimerSlotMap;
+	typedef Common::Array<TimerSlot *> TimerQueue;
 
 	Common::Mutex _mutex;
-	TimerSlot *_head;
 	TimerSlotMap _callbacks;
 
+	/**
+	 * The installed timers, organized as a binary min-heap ordered by the
+	 * time they are due next. Timers due at the same time are ordered by
+	 * when they were queued.
+	 */
+	TimerQueue _queue;
+
+	/** Sequence number given to the next queued timer. */
+	uint32 _nextSequence;
+
+	void heapPush(TimerSlot *slot);
+	TimerSlot *heapPop();
+	void heapSiftDown(uint pos);
+
 public:
 	DefaultTimerManager();
 	virtual ~DefaultTimerManager();
@@ -45,9 +60,17 @@ public:
 	virtual void removeTimerProc(TimerProc proc);
 
 	/**
-	 * Timer callback, to be invoked at regular time intervals by the backend.
+	 * Timer callback, to be invoked by the backend. Invokes all timer
+	 * callbacks which are due.
+	 *
+	 * Backends which can schedule their timer freely should invoke the
+	 * handler again after the returned delay instead of using a fixed
+	 * period, to reduce the jitter of the timer callbacks.
+	 *
+	 * @param maxDelay	upper bound for the returned delay in milliseconds
+	 * @return the time in milliseconds until the next callback is due
 	 */
-	void handler();
+	uint32 handler(uint32 maxDelay = 10);
 };
 
 #endif
@@ -28,10 +28,14 @@
 #include "backends/timer/sdl/sdl-timer.h"
 
 #include "common/textconsole.h"
+#include "common/util.h"
 
 static Uint32 timer_handler(Uint32 interval, void *param) {
-	((DefaultTimerManager *)param)->handler();
-	return interval;
+	// Sleep until the next timer callback is due instead of using a fixed
+	// period. We never wait longer than the initial interval though, so
+	// newly installed timers are picked up in time. Note that returning 0
+	// would cancel the SDL timer.
+	return MAX<Uint32>(((DefaultTimerManager *)param)->handler(SdlTimerManager::kTimerPeriod), 1);
 }
 
 SdlTimerManager::SdlTimerManager() {
@@ -41,7 +45,7 @@ SdlTimerManager::SdlTimerManager() {
 	}
 
 	// Creates the timer callback
-	_timerID = SDL_AddTimer(10, &timer_handler, this);
+	_timerID = SDL_AddTimer(kTimerPeriod, &timer_handler, this);
 }
 
 SdlTimerManager::~SdlTimerManager() {
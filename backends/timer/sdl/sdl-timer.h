@@ -33,6 +33,11 @@
  */
 class SdlTimerManager : public DefaultTimerManager {
 public:
+	enum {
+		/** Maximum time in milliseconds between two invocations of the handler. */
+		kTimerPeriod = 10
+	};
+
 	SdlTimerManager();
 	virtual ~SdlTimerManager();
 
@@ -197,6 +197,7 @@ void registerDefaults() {
 
 	ConfMan.registerDefault("music_driver", "auto");
 	ConfMan.registerDefault("mt32_device", "null");
+	ConfMan.registerDefault("mt32_render_ahead", false);
 	ConfMan.registerDefault("gm_device", "null");
 
 	ConfMan.registerDefault("cdrom", 0);
@@ -57,6 +57,7 @@
 
 #include "audio/mididrv.h"
 #include "audio/musicplugin.h"  /* for music manager */
+#include "audio/pcmcache.h"
 
 #include "graphics/cursorman.h"
 #include "graphics/fontman.h"
@@ -258,6 +259,9 @@ static Common::Error runGame(const EnginePlugin *plugin, OSystem &system, const
 	// Reset the file/directory mappings
 	SearchMan.clear();
 
+	// Drop the decoded sounds of the game, their keys are only valid for it
+	PCMCacheMan.clear();
+
 	// Return result (== 0 means no error)
 	return result;
 }
@@ -573,6 +577,7 @@ extern "C" int scummvm_main(int argc, const char * const argv[]) {
 	Common::TranslationManager::destroy();
 #endif
 	MusicManager::destroy();
+	Audio::PCMCache::destroy();
 	Graphics::CursorManager::destroy();
 	Graphics::FontManager::destroy();
 #ifdef USE_FREETYPE2
@@ -62,6 +62,10 @@ int Archive::listMatchingMembers(ArchiveMemberList &list, const String &pattern)
 
 
 
+// Bumped whenever the archives of any SearchSet change, invalidating the
+// lookup caches of all of them.
+static uint32 s_searchSetGeneration = 1;
+
 SearchSet::ArchiveNodeList::iterator SearchSet::find(const String &name) {
 	ArchiveNodeList::iterator it = _list.begin();
 	for ( ; it != _list.end(); ++it) {
@@ -86,6 +90,8 @@ SearchSet::ArchiveNodeList::const_iterator SearchSet::find(const String &name) c
 	order prevails.
 */
 void SearchSet::insert(const Node &node) {
+	++s_searchSetGeneration;
+
 	ArchiveNodeList::iterator it = _list.begin();
 	for ( ; it != _list.end(); ++it) {
 		if (it->_priority < node._priority)
@@ -174,6 +180,7 @@ void SearchSet::remove(const String &name) {
 		if (it->_autoFree)
 			delete it->_arc;
 		_list.erase(it);
+		++s_searchSetGeneration;
 	}
 }
 
@@ -188,6 +195,7 @@ void SearchSet::clear() {
 	}
 
 	_list.clear();
+	++s_searchSetGeneration;
 }
 
 void SearchSet::setPriority(const String &name, int priority) {
@@ -206,17 +214,35 @@ void SearchSet::setPriority(const String &name, int priority) {
 	insert(node);
 }
 
-bool SearchSet::hasFile(const String &name) const {
-	if (name.empty())
-		return false;
+Archive *SearchSet::findArchive(const String &name) const {
+	if (_lookupCacheGeneration != s_searchSetGeneration) {
+		_lookupCache.clear();
+		_lookupCacheGeneration = s_searchSetGeneration;
+	}
+
+	LookupCache::const_iterator cached = _lookupCache.find(name);
+	if (cached != _lookupCache.end())
+		return cached->_value;
+
+	Archive *archive = 0;
 
 	ArchiveNodeList::const_iterator it = _list.begin();
 	for ( ; it != _list.end(); ++it) {
-		if (it->_arc->hasFile(name))
-			return true;
+		if (it->_arc->hasFile(name)) {
+			archive = it->_arc;
+			break;
+		}
 	}
 
-	return false;
+	_lookupCache[name] = archive;
+	return archive;
+}
+
+bool SearchSet::hasFile(const String &name) const {
+	if (name.empty())
+		return false;
+
+	return findArchive(name) != 0;
 }
 
 int SearchSet::listMatchingMembers(ArchiveMemberList &list, const String &pattern) const {
@@ -243,11 +269,9 @@ const ArchiveMemberPtr SearchSet::getMember(const String &name) const {
 	if (name.empty())
 		return ArchiveMemberPtr();
 
-	ArchiveNodeList::const_iterator it = _list.begin();
-	for ( ; it != _list.end(); ++it) {
-		if (it->_arc->hasFile(name))
-			return it->_arc->getMember(name);
-	}
+	Archive *archive = findArchive(name);
+	if (archive)
+		return archive->getMember(name);
 
 	return ArchiveMemberPtr();
 }
@@ -256,9 +280,25 @@ SeekableReadStream *SearchSet::createReadStreamForMember(const String &name) con
 	if (name.empty())
 		return 0;
 
+	Archive *archive = findArchive(name);
+	if (!archive)
+		return 0;
+
+	SeekableReadStream *stream = archive->createReadStreamForMember(name);
+	if (stream)
+		return stream;
+
+	// The file could not be opened after all, e.g. because it was deleted
+	// after it had been looked up. Forget about it and try the remaining
+	// archives, in order.
+	_lookupCache.erase(name);
+
 	ArchiveNodeList::const_iterator it = _list.begin();
-	for ( ; it != _list.end(); ++it) {
-		SeekableReadStream *stream = it->_arc->createReadStreamForMember(name);
+	while (it->_arc != archive)
+		++it;
+
+	for (++it; it != _list.end(); ++it) {
+		stream = it->_arc->createReadStreamForMember(name);
 		if (stream)
 			return stream;
 	}
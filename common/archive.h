@@ -24,6 +24,8 @@
 #define COMMON_ARCHIVE_H
 
 #include "common/str.h"
+#include "common/hashmap.h"
+#include "common/hash-str.h"
 #include "common/list.h"
 #include "common/ptr.h"
 #include "common/singleton.h"
@@ -146,7 +148,19 @@ class SearchSet : public Archive {
 	// Add an archive keeping the list sorted by descending priority.
 	void insert(const Node& node);
 
+	// The archive each looked up name was found in first, or 0 if it was
+	// not found in any. This assumes that the contents of the archives do
+	// not change while they are in the set, as FSDirectory does anyway.
+	// It is reset whenever the archives of any search set change, since
+	// search sets may be nested.
+	typedef HashMap<String, Archive *> LookupCache;
+	mutable LookupCache _lookupCache;
+	mutable uint32 _lookupCacheGeneration;
+
+	Archive *findArchive(const String &name) const;
+
 public:
+	SearchSet() : _lookupCacheGeneration(0) {}
 	virtual ~SearchSet() { clear(); }
 
 	/**
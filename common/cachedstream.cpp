@@ -0,0 +1,201 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#include "common/cachedstream.h"
+#include "common/debug.h"
+#include "common/textconsole.h"
+#include "common/util.h"
+
+namespace Common {
+
+CachedSeekableReadStream::CachedSeekableReadStream(SeekableReadStream *parentStream, uint32 blockSize, uint numBlocks, DisposeAfterUse::Flag disposeParentStream)
+	: _parentStream(parentStream, disposeParentStream),
+	_blockSize(blockSize),
+	_numBlocks(numBlocks),
+	_pos(0),
+	_eos(false),
+	_clock(0),
+	_nextSequential(0),
+	_hits(0),
+	_misses(0),
+	_readAheads(0) {
+
+	assert(parentStream);
+	assert(blockSize > 0 && numBlocks > 0);
+
+	_pos = _parentStream->pos();
+	_size = _parentStream->size();
+
+	_data = new byte[_blockSize * _numBlocks];
+	_blocks.resize(_numBlocks);
+	for (uint i = 0; i < _numBlocks; ++i) {
+		_blocks[i].index = -1;
+		_blocks[i].size = 0;
+		_blocks[i].lastUsed = 0;
+		_blocks[i].data = _data + i * _blockSize;
+	}
+}
+
+CachedSeekableReadStream::~CachedSeekableReadStream() {
+	if (_hits || _misses)
+		debug(2, "CachedSeekableReadStream: %u block hits, %u misses, %u blocks read ahead", _hits, _misses, _readAheads);
+
+	delete[] _data;
+}
+
+uint32 CachedSeekableReadStream::read(void *dataPtr, uint32 dataSize) {
+	byte *dst = (byte *)dataPtr;
+	uint32 alreadyRead = 0;
+
+	if (dataSize > _size - _pos) {
+		dataSize = _size - _pos;
+		_eos = true;
+	}
+
+	// Reads larger than the whole cache would only flush it, so they go
+	// straight to the parent stream.
+	if (dataSize >= _blockSize * _numBlocks) {
+		++_misses;
+		_parentStream->seek(_pos);
+		alreadyRead = _parentStream->read(dst, dataSize);
+		_pos += alreadyRead;
+		if (alreadyRead < dataSize)
+			_eos = true;
+		return alreadyRead;
+	}
+
+	while (alreadyRead < dataSize) {
+		const Block *block = getBlock(_pos / _blockSize);
+		const uint32 offset = _pos % _blockSize;
+
+		if (!block || block->size <= offset) {
+			// The parent stream returned less than it claimed to have
+			_eos = true;
+			break;
+		}
+
+		const uint32 n = MIN(dataSize - alreadyRead, block->size - offset);
+		memcpy(dst + alreadyRead, block->data + offset, n);
+		alreadyRead += n;
+		_pos += n;
+	}
+
+	return alreadyRead;
+}
+
+bool CachedSeekableReadStream::seek(int32 offset, int whence) {
+	switch (whence) {
+	case SEEK_END:
+		offset = _size + offset;
+		// fall through
+	case SEEK_SET:
+		break;
+	case SEEK_CUR:
+		offset = _pos + offset;
+		break;
+	default:
+		return false;
+	}
+
+	if (offset < 0 || (uint32)offset > _size)
+		return false;
+
+	_pos = offset;
+	_eos = false;
+	return true;
+}
+
+void CachedSeekableReadStream::prefetch(uint32 offset, uint32 length) {
+	if (offset >= _size || !length)
+		return;
+
+	const uint32 first = offset / _blockSize;
+	const uint32 last = MIN<uint32>((MIN(_size - offset, length) + offset - 1) / _blockSize, first + _numBlocks - 1);
+
+	for (uint32 index = first; index <= last; ++index) {
+		if (!findBlock(index) && loadBlock(index))
+			++_readAheads;
+	}
+}
+
+CachedSeekableReadStream::Block *CachedSeekableReadStream::findBlock(uint32 index) {
+	for (uint i = 0; i < _numBlocks; ++i) {
+		if (_blocks[i].index == (int32)index)
+			return &_blocks[i];
+	}
+
+	return 0;
+}
+
+CachedSeekableReadStream::Block *CachedSeekableReadStream::loadBlock(uint32 index) {
+	// Replace an unused block, or else the least recently used one
+	Block *block = &_blocks[0];
+	for (uint i = 1; i < _numBlocks && block->index != -1; ++i) {
+		if (_blocks[i].index == -1 || _blocks[i].lastUsed < block->lastUsed)
+			block = &_blocks[i];
+	}
+
+	const uint32 start = index * _blockSize;
+	block->index = -1;
+
+	if (!_parentStream->seek(start))
+		return 0;
+
+	block->size = _parentStream->read(block->data, MIN(_blockSize, _size - start));
+	if (_parentStream->err()) {
+		warning("CachedSeekableReadStream: Failed to read block %d", index);
+		return 0;
+	}
+
+	block->index = index;
+	block->lastUsed = ++_clock;
+	return block;
+}
+
+const CachedSeekableReadStream::Block *CachedSeekableReadStream::getBlock(uint32 index) {
+	Block *block = findBlock(index);
+	if (block) {
+		++_hits;
+		block->lastUsed = ++_clock;
+		return block;
+	}
+
+	++_misses;
+	block = loadBlock(index);
+	if (!block)
+		return 0;
+
+	// Read ahead when the blocks are requested in sequence
+	if (index == _nextSequential && _numBlocks > 1 && (index + 1) * _blockSize < _size && !findBlock(index + 1)) {
+		if (loadBlock(index + 1)) {
+			++_readAheads;
+			++index;
+		}
+		// The read-ahead block is the most recently used one now
+		block->lastUsed = ++_clock;
+	}
+
+	_nextSequential = index + 1;
+	return block;
+}
+
+} // End of namespace Common
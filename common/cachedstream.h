@@ -0,0 +1,108 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#ifndef COMMON_CACHEDSTREAM_H
+#define COMMON_CACHEDSTREAM_H
+
+#include "common/array.h"
+#include "common/ptr.h"
+#include "common/stream.h"
+#include "common/types.h"
+
+namespace Common {
+
+/**
+ * CachedSeekableReadStream keeps a number of fixed size blocks of its parent
+ * stream in memory, and serves reads from them. Unlike the buffered streams
+ * it does not drop its data on a seek, so that streams which are read with
+ * many small reads and seeks back and forth (e.g. container formats, which
+ * first parse an index and then read the data it points to) only hit the
+ * parent stream once per block. When blocks are requested in sequence, the
+ * following block is read ahead. The least recently used block is replaced
+ * when the cache is full.
+ *
+ * The parent stream is always seeked before it is read from, so it may be
+ * used by others in between.
+ *
+ * The cache statistics are printed on debug level 2 when the stream is
+ * deleted, which helps tuning the block size and count of a user.
+ */
+class CachedSeekableReadStream : public SeekableReadStream {
+public:
+	CachedSeekableReadStream(SeekableReadStream *parentStream, uint32 blockSize = 4096, uint numBlocks = 16, DisposeAfterUse::Flag disposeParentStream = DisposeAfterUse::NO);
+	~CachedSeekableReadStream();
+
+	virtual bool eos() const { return _eos; }
+	virtual bool err() const { return _parentStream->err(); }
+	virtual void clearErr() { _eos = false; _parentStream->clearErr(); }
+	virtual uint32 read(void *dataPtr, uint32 dataSize);
+
+	virtual int32 pos() const { return _pos; }
+	virtual int32 size() const { return _size; }
+	virtual bool seek(int32 offset, int whence = SEEK_SET);
+
+	/**
+	 * Hint that the given range will be read soon. The blocks covering it
+	 * which are not cached yet are loaded now, up to the capacity of the
+	 * cache.
+	 */
+	void prefetch(uint32 offset, uint32 length);
+
+	/** Return the number of block requests served from the cache. */
+	uint32 getHits() const { return _hits; }
+	/** Return the number of block requests which had to read the parent stream. */
+	uint32 getMisses() const { return _misses; }
+	/** Return the number of blocks loaded by read-ahead or prefetch(). */
+	uint32 getReadAheads() const { return _readAheads; }
+
+private:
+	struct Block {
+		int32 index;      ///< index of the block in the stream, -1 if unused
+		uint32 size;      ///< size of the valid data, smaller for the last block
+		uint32 lastUsed;  ///< value of _clock when the block was last used
+		byte *data;
+	};
+
+	Block *findBlock(uint32 index);
+	Block *loadBlock(uint32 index);
+	const Block *getBlock(uint32 index);
+
+	DisposablePtr<SeekableReadStream> _parentStream;
+	const uint32 _blockSize;
+	const uint32 _numBlocks;
+	byte *_data;
+	Array<Block> _blocks;
+
+	uint32 _pos;
+	uint32 _size;
+	bool _eos;
+
+	uint32 _clock;
+	uint32 _nextSequential; ///< block index which continues the last sequential miss
+	uint32 _hits;
+	uint32 _misses;
+	uint32 _readAheads;
+};
+
+} // End of namespace Common
+
+#endif
@@ -145,6 +145,18 @@ public:
 	 */
 	virtual bool pollEvent(Event &event) = 0;
 
+	/**
+	 * Waits until an event is available from the source, or the given
+	 * amount of milliseconds passed. The event is not consumed.
+	 *
+	 * By default waiting is not supported.
+	 *
+	 * @param	msecs	the maximum time to wait in milliseconds.
+	 * @return	true if the source supports waiting, false if it returned
+	 *			immediately and the caller has to sleep on its own.
+	 */
+	virtual bool waitForEvent(uint msecs) { return false; }
+
 	/**
 	 * Checks whether events from this source are allowed to be mapped.
 	 *
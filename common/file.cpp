@@ -141,6 +141,11 @@ uint32 File::read(void *ptr, uint32 len) {
 	return _handle->read(ptr, len);
 }
 
+SeekableReadStream *File::readStream(uint32 dataSize) {
+	assert(_handle);
+	return _handle->readStream(dataSize);
+}
+
 
 DumpFile::DumpFile() : _handle(0) {
 }
@@ -2,6 +2,7 @@ MODULE := common
 
 MODULE_OBJS := \
 	archive.o \
+	cachedstream.o \
 	config-manager.o \
 	coroutines.o \
 	dcl.o \
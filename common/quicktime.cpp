@@ -28,6 +28,7 @@
 // Seek function by Gael Chardon gael.dev@4now.net
 //
 
+#include "common/cachedstream.h"
 #include "common/debug.h"
 #include "common/endian.h"
 #include "common/macresman.h"
@@ -84,7 +85,9 @@ bool QuickTimeParser::parseFile(const String &filename) {
 		delete _fd;
 	}
 
-	_fd = _resFork->getDataFork();
+	// The atoms are parsed with many small reads, and the samples of the
+	// tracks are interleaved, so keep the recently used parts of the file
+	_fd = new CachedSeekableReadStream(_resFork->getDataFork(), 4096, 16, DisposeAfterUse::YES);
 	atom.size = _fd->size();
 
 	if (readDefault(atom) < 0 || !_foundMOOV)
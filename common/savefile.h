@@ -74,6 +74,13 @@ protected:
 	virtual void setError(Error error, const String &errorDesc) { _error = error; _errorDesc = errorDesc; }
 
 public:
+	/** The state of writing a savefile, see getSaveStatus(). */
+	enum SaveStatus {
+		kSaveComplete,		///< The savefile has been written completely (or is unknown)
+		kSaveInProgress,	///< The savefile is still being written in the background
+		kSaveFailed			///< Writing the savefile in the background failed
+	};
+
 	virtual ~SaveFileManager() {}
 
 	/**
@@ -136,6 +143,42 @@ public:
 	 */
 	virtual bool removeSavefile(const String &name) = 0;
 
+	/**
+	 * Query whether the given savefile has been written completely.
+	 *
+	 * Implementations may continue writing a savefile after it has been
+	 * finalized and deleted by the caller, so errors occurring then can not
+	 * be reported through OutSaveFile::err(). They are reported by this
+	 * method instead, until the savefile is opened for saving or removed
+	 * again.
+	 *
+	 * A savefile which is still open for saving can not be finished, so
+	 * kSaveInProgress is returned for it even if wait is set.
+	 *
+	 * The default implementation writes savefiles synchronously and always
+	 * returns kSaveComplete.
+	 *
+	 * @param name	the name of the savefile
+	 * @param wait	whether to finish writing the savefile first
+	 * @return the state of the savefile
+	 */
+	virtual SaveStatus getSaveStatus(const String &name, bool wait = false) { return kSaveComplete; }
+
+	/**
+	 * Query the size and the modification time of the given savefile,
+	 * without opening it. This allows callers to cheaply detect whether
+	 * a savefile changed since it was last looked at.
+	 *
+	 * The default implementation does not support this and returns false.
+	 *
+	 * @param name			the name of the savefile
+	 * @param size			receives the size of the savefile in bytes
+	 * @param modifiedTime	receives the modification time of the savefile
+	 *						(in an unspecified, but monotonic, unit)
+	 * @return true if the information could be obtained, false otherwise.
+	 */
+	virtual bool getSavefileInfo(const String &name, uint32 &size, uint32 &modifiedTime) { return false; }
+
 	/**
 	 * Renames the given savefile.
 	 * @param oldName Old name.
@@ -400,8 +400,10 @@ public:
 	 * if reading more failed, because of an I/O error or because
 	 * the end of the stream was reached. Which can be determined by
 	 * calling err() and eos().
+	 * Streams which already hold their data in memory may return a stream
+	 * sharing it instead of a copy.
 	 */
-	SeekableReadStream *readStream(uint32 dataSize);
+	virtual SeekableReadStream *readStream(uint32 dataSize);
 
 };
 
@@ -902,6 +902,19 @@ public:
 	/** Delay/sleep for the specified amount of milliseconds. */
 	virtual void delayMillis(uint msecs) = 0;
 
+	/**
+	 * Sleep until an event is available or the specified amount of
+	 * milliseconds passed, whichever happens first. The event itself is not
+	 * consumed, it can be fetched with EventManager::pollEvent afterwards.
+	 *
+	 * Engines waiting for the next frame should use this instead of
+	 * sleeping with delayMillis in small steps, since it reacts to input
+	 * immediately without waking up the CPU unnecessarily.
+	 *
+	 * The default implementation simply sleeps for the given time.
+	 */
+	virtual void waitForEvent(uint msecs) { delayMillis(msecs); }
+
 	/**
 	 * Get the current time and date, in the local timezone.
 	 * Corresponds on many systems to the combination of time()
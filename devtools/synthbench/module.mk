@@ -0,0 +1,26 @@
+
+MODULE := devtools/synthbench
+
+MODULE_OBJS := \
+	synthbench.o
+
+# The synths, the mixer and the file system code are taken from the
+# regular ScummVM libraries. These depend on each other, so they are
+# listed more than once.
+TOOL_DEPS := \
+	audio/libaudio.a \
+	common/libcommon.a \
+	backends/libbackends.a \
+	audio/libaudio.a \
+	common/libcommon.a
+
+ifdef USE_MT32EMU
+TOOL_DEPS += \
+	audio/softsynth/mt32/libmt32.a
+endif
+
+# Set the name of the executable
+TOOL_EXECUTABLE := synthbench
+
+# Include common rules
+include $(srcdir)/rules.mk
@@ -0,0 +1,719 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+/*
+ * synthbench renders recorded MIDI files or OPL/CMS register streams
+ * through the software synths, without running a game. The synths are
+ * driven through the regular mixer, which is pulled by the tool instead of
+ * an audio device. It reports the real-time factor and the time spent per
+ * mixer callback, can write the output as raw PCM and compares the MD5 of
+ * the output against a stored reference.
+ */
+
+// Disable symbol overrides so that we can use system headers.
+#define FORBIDDEN_SYMBOL_ALLOW_ALL
+
+// HACK to allow building with the SDL backend on MinGW
+// see bug #1800764 "TOOLS: MinGW tools building broken"
+#ifdef main
+#undef main
+#endif // main
+
+#include "common/scummsys.h"
+#include "common/algorithm.h"
+#include "common/array.h"
+#include "common/config-manager.h"
+#include "common/error.h"
+#include "common/file.h"
+#include "common/fs.h"
+#include "common/md5.h"
+#include "common/memstream.h"
+#include "common/system.h"
+#include "common/util.h"
+
+#include "audio/audiostream.h"
+#include "audio/fmopl.h"
+#include "audio/mididrv.h"
+#include "audio/midiparser.h"
+#include "audio/mixer_intern.h"
+#include "audio/musicplugin.h"
+#include "audio/softsynth/cms.h"
+#include "audio/softsynth/emumidi.h"
+#include "audio/softsynth/fmtowns_pc98/towns_midi.h"
+
+#ifdef USE_MT32EMU
+#include "audio/softsynth/mt32/mt32emu.h"
+#endif
+
+#include "backends/audiocd/audiocd.h"
+
+#if defined(POSIX)
+#include "backends/fs/posix/posix-fs-factory.h"
+#elif defined(WIN32)
+#include "backends/fs/windows/windows-fs-factory.h"
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/time.h>
+
+// The AdLib MIDI driver is only reachable through its plugin object
+extern PluginObject *g_ADLIB_getObject();
+
+static uint32 getMicros() {
+	timeval tv;
+	gettimeofday(&tv, 0);
+	return tv.tv_sec * 1000000 + tv.tv_usec;
+}
+
+#pragma mark -
+#pragma mark --- Headless system ---
+#pragma mark -
+
+/**
+ * Audio CD manager which ignores everything. The default one would pull in
+ * all the audio decoders and their libraries.
+ */
+class NullAudioCDManager : public AudioCDManager {
+public:
+	NullAudioCDManager() { memset(&_status, 0, sizeof(_status)); }
+
+	void play(int track, int numLoops, int startFrame, int duration, bool only_emulate = false) {}
+	bool isPlaying() const { return false; }
+	void setVolume(byte volume) { _status.volume = volume; }
+	void setBalance(int8 balance) { _status.balance = balance; }
+	void stop() {}
+	void update() {}
+	Status getStatus() const { return _status; }
+
+	bool openCD(int drive) { return false; }
+	bool pollCD() const { return false; }
+	void playCD(int track, int num_loops, int start_frame, int duration) {}
+	void stopCD() {}
+	void updateCD() {}
+
+private:
+	Status _status;
+};
+
+/**
+ * Minimal OSystem providing just what the synths need: a mixer, mutexes
+ * (which are not needed, since everything runs on one thread), the clock
+ * and file system access for ROM images.
+ */
+class BenchSystem : public OSystem {
+public:
+	BenchSystem(uint rate) : _startMillis(getMicros() / 1000) {
+		// The mixer creates mutexes through g_system
+		g_system = this;
+
+#if defined(POSIX)
+		_fsFactory = new POSIXFilesystemFactory();
+#elif defined(WIN32)
+		_fsFactory = new WindowsFilesystemFactory();
+#endif
+		_mixer = new Audio::MixerImpl(this, rate);
+		_mixer->setReady(true);
+
+		// The FM-Towns driver sets the CD audio volume
+		_audiocdManager = new NullAudioCDManager();
+	}
+
+	~BenchSystem() {
+		delete _audiocdManager;
+		_audiocdManager = 0;
+		delete _mixer;
+	}
+
+	Audio::MixerImpl *getMixerImpl() { return _mixer; }
+
+	// Graphics, none of this is available
+	const GraphicsMode *getSupportedGraphicsModes() const { return s_noGraphicsModes; }
+	int getDefaultGraphicsMode() const { return 0; }
+	bool setGraphicsMode(int mode) { return true; }
+	int getGraphicsMode() const { return 0; }
+	Graphics::PixelFormat getScreenFormat() const { return Graphics::PixelFormat::createFormatCLUT8(); }
+	Common::List<Graphics::PixelFormat> getSupportedFormats() const { return Common::List<Graphics::PixelFormat>(); }
+	void initSize(uint width, uint height, const Graphics::PixelFormat *format) {}
+	int16 getHeight() { return 0; }
+	int16 getWidth() { return 0; }
+	PaletteManager *getPaletteManager() { return 0; }
+	void copyRectToScreen(const void *buf, int pitch, int x, int y, int w, int h) {}
+	Graphics::Surface *lockScreen() { return 0; }
+	void unlockScreen() {}
+	void fillScreen(uint32 col) {}
+	void updateScreen() {}
+	void setShakePos(int shakeOffset) {}
+	void showOverlay() {}
+	void hideOverlay() {}
+	Graphics::PixelFormat getOverlayFormat() const { return Graphics::PixelFormat::createFormatCLUT8(); }
+	void clearOverlay() {}
+	void grabOverlay(void *buf, int pitch) {}
+	void copyRectToOverlay(const void *buf, int pitch, int x, int y, int w, int h) {}
+	int16 getOverlayHeight() { return 0; }
+	int16 getOverlayWidth() { return 0; }
+	bool showMouse(bool visible) { return false; }
+	void warpMouse(int x, int y) {}
+	void setMouseCursor(const void *buf, uint w, uint h, int hotspotX, int hotspotY, uint32 keycolor, bool dontScale, const Graphics::PixelFormat *format) {}
+
+	uint32 getMillis(bool skipRecord = false) { return getMicros() / 1000 - _startMillis; }
+	void delayMillis(uint msecs) {}
+	void getTimeAndDate(TimeDate &t) const { memset(&t, 0, sizeof(t)); }
+
+	MutexRef createMutex() { return (MutexRef)1; }
+	void lockMutex(MutexRef mutex) {}
+	void unlockMutex(MutexRef mutex) {}
+	void deleteMutex(MutexRef mutex) {}
+
+	Audio::Mixer *getMixer() { return _mixer; }
+
+	void quit() { exit(1); }
+	void displayMessageOnOSD(const char *msg) {}
+
+	void logMessage(LogMessageType::Type type, const char *message) {
+		FILE *output = (type == LogMessageType::kInfo || type == LogMessageType::kDebug) ? stdout : stderr;
+		fputs(message, output);
+		fflush(output);
+	}
+
+private:
+	static const GraphicsMode s_noGraphicsModes[];
+
+	Audio::MixerImpl *_mixer;
+	uint32 _startMillis;
+};
+
+const OSystem::GraphicsMode BenchSystem::s_noGraphicsModes[] = {
+	{ 0, 0, 0 }
+};
+
+#pragma mark -
+#pragma mark --- Register streams ---
+#pragma mark -
+
+struct RegisterWrite {
+	uint32 delay; ///< delay in milliseconds before this write
+	uint16 reg;
+	uint8 value;
+};
+
+typedef Common::Array<RegisterWrite> RegisterStream;
+
+static byte *loadFile(const char *filename, uint32 &size) {
+	FILE *file = fopen(filename, "rb");
+	if (!file)
+		return 0;
+
+	fseek(file, 0, SEEK_END);
+	size = ftell(file);
+	fseek(file, 0, SEEK_SET);
+
+	byte *data = new byte[size];
+	if (fread(data, 1, size, file) != size) {
+		delete[] data;
+		data = 0;
+	}
+	fclose(file);
+	return data;
+}
+
+/**
+ * Parses a DOSBox raw OPL capture (version 2.0).
+ */
+static bool parseDRO(const byte *data, uint32 size, RegisterStream &stream, OPL::Config::OplType &type) {
+	if (size < 26 || memcmp(data, "DBRAWOPL", 8) || READ_LE_UINT16(data + 8) != 2) {
+		fprintf(stderr, "Only DOSBox raw OPL captures version 2.0 are supported\n");
+		return false;
+	}
+
+	const uint32 pairs = READ_LE_UINT32(data + 12);
+	switch (data[20]) {
+	case 0:
+		type = OPL::Config::kOpl2;
+		break;
+	case 1:
+		type = OPL::Config::kDualOpl2;
+		break;
+	default:
+		type = OPL::Config::kOpl3;
+		break;
+	}
+
+	const byte shortDelayCode = data[23];
+	const byte longDelayCode = data[24];
+	const byte codemapLength = data[25];
+	const byte *codemap = data + 26;
+	const byte *pos = codemap + codemapLength;
+
+	if (data[21] != 0 || data[22] != 0 || pos + pairs * 2 > data + size) {
+		fprintf(stderr, "Unsupported or truncated DRO file\n");
+		return false;
+	}
+
+	uint32 delay = 0;
+	for (uint32 i = 0; i < pairs; ++i, pos += 2) {
+		if (pos[0] == shortDelayCode) {
+			delay += pos[1] + 1;
+		} else if (pos[0] == longDelayCode) {
+			delay += (pos[1] + 1) << 8;
+		} else if ((pos[0] & 0x7F) < codemapLength) {
+			RegisterWrite write;
+			write.delay = delay;
+			write.reg = codemap[pos[0] & 0x7F] | ((pos[0] & 0x80) ? 0x100 : 0);
+			write.value = pos[1];
+			stream.push_back(write);
+			delay = 0;
+		}
+	}
+
+	return true;
+}
+
+/**
+ * Parses a text register stream. Each line holds the delay in milliseconds
+ * before the write, the register (or port) and the value, the latter two
+ * in hex. Lines starting with '#' are ignored.
+ */
+static bool parseTextRegisters(const byte *data, uint32 size, RegisterStream &stream) {
+	Common::String text((const char *)data, size);
+	const char *pos = text.c_str();
+
+	while (*pos) {
+		const char *end = strchr(pos, '\n');
+		Common::String line = end ? Common::String(pos, end) : Common::String(pos);
+		pos = end ? end + 1 : pos + strlen(pos);
+
+		line.trim();
+		if (line.empty() || line[0] == '#')
+			continue;
+
+		uint delay, reg, value;
+		if (sscanf(line.c_str(), "%u %x %x", &delay, &reg, &value) != 3) {
+			fprintf(stderr, "Invalid register stream line '%s'\n", line.c_str());
+			return false;
+		}
+
+		RegisterWrite write;
+		write.delay = delay;
+		write.reg = reg;
+		write.value = value;
+		stream.push_back(write);
+	}
+
+	return true;
+}
+
+/**
+ * A chip which is fed by a register stream.
+ */
+class RegisterChip {
+public:
+	virtual ~RegisterChip() {}
+	virtual void write(uint16 reg, uint8 value) = 0;
+	virtual void generate(int16 *buffer, int numSamples) = 0;
+	virtual bool isStereo() const = 0;
+};
+
+class OPLChip : public RegisterChip {
+public:
+	OPLChip(OPL::OPL *opl, OPL::Config::OplType type) : _opl(opl), _type(type) {}
+	~OPLChip() { delete _opl; }
+
+	void write(uint16 reg, uint8 value) {
+		if (reg >= 0x100 && _type == OPL::Config::kDualOpl2) {
+			_opl->write(0x222, reg & 0xFF);
+			_opl->write(0x223, value);
+		} else {
+			_opl->writeReg(reg, value);
+		}
+	}
+
+	void generate(int16 *buffer, int numSamples) { _opl->readBuffer(buffer, numSamples); }
+	bool isStereo() const { return _opl->isStereo(); }
+
+private:
+	OPL::OPL *_opl;
+	OPL::Config::OplType _type;
+};
+
+class CMSChip : public RegisterChip {
+public:
+	CMSChip(uint rate) : _cms(rate) {}
+
+	void write(uint16 reg, uint8 value) { _cms.portWrite(reg, value); }
+	// The emulator counts stereo frames, not samples
+	void generate(int16 *buffer, int numSamples) { _cms.readBuffer(buffer, numSamples / 2); }
+	bool isStereo() const { return true; }
+
+private:
+	CMSEmulator _cms;
+};
+
+/**
+ * Plays a register stream on a chip, at the output rate of the mixer.
+ */
+class RegisterStreamPlayer : public Audio::AudioStream {
+public:
+	RegisterStreamPlayer(RegisterChip *chip, const RegisterStream &stream, int rate)
+		: _chip(chip), _stream(stream), _rate(rate), _next(0), _framesToNext(0), _tail(rate) {
+		queueNext();
+	}
+
+	~RegisterStreamPlayer() { delete _chip; }
+
+	int readBuffer(int16 *buffer, const int numSamples) {
+		const int channels = isStereo() ? 2 : 1;
+		int frames = numSamples / channels;
+
+		while (frames > 0) {
+			while (_next < _stream.size() && !_framesToNext) {
+				_chip->write(_stream[_next].reg, _stream[_next].value);
+				++_next;
+				queueNext();
+			}
+
+			int step = frames;
+			if (_next < _stream.size())
+				step = MIN<uint32>(step, _framesToNext);
+			else
+				_tail = (_tail > (uint32)step) ? _tail - step : 0;
+
+			_chip->generate(buffer, step * channels);
+			buffer += step * channels;
+			frames -= step;
+			if (_next < _stream.size())
+				_framesToNext -= step;
+		}
+
+		return numSamples;
+	}
+
+	bool isStereo() const { return _chip->isStereo(); }
+	int getRate() const { return _rate; }
+	bool endOfData() const { return _next >= _stream.size() && !_tail; }
+
+private:
+	void queueNext() {
+		if (_next < _stream.size())
+			_framesToNext = (uint32)((uint64)_stream[_next].delay * _rate / 1000);
+	}
+
+	RegisterChip *_chip;
+	const RegisterStream &_stream;
+	const int _rate;
+	uint _next;
+	uint32 _framesToNext;
+	uint32 _tail; ///< frames rendered after the last write, to let notes decay
+};
+
+#pragma mark -
+#pragma mark --- MT-32 ---
+#pragma mark -
+
+#ifdef USE_MT32EMU
+/**
+ * The MT-32 emulator without the GUI parts of the ScummVM driver.
+ */
+class MidiDriver_BenchMT32 : public MidiDriver_Emulated {
+public:
+	MidiDriver_BenchMT32(Audio::Mixer *mixer, const Common::String &romPath)
+		: MidiDriver_Emulated(mixer), _romPath(romPath), _synth(0), _controlROM(0), _pcmROM(0) {}
+
+	~MidiDriver_BenchMT32() {
+		delete _synth;
+		if (_controlROM)
+			MT32Emu::ROMImage::freeROMImage(_controlROM);
+		if (_pcmROM)
+			MT32Emu::ROMImage::freeROMImage(_pcmROM);
+	}
+
+	int open() {
+		Common::FSNode dir(_romPath);
+		if ((!_controlFile.open(dir.getChild("MT32_CONTROL.ROM")) && !_controlFile.open(dir.getChild("CM32L_CONTROL.ROM")))
+		    || (!_pcmFile.open(dir.getChild("MT32_PCM.ROM")) && !_pcmFile.open(dir.getChild("CM32L_PCM.ROM")))) {
+			fprintf(stderr, "MT-32 ROMs not found in '%s'\n", _romPath.c_str());
+			return MERR_DEVICE_NOT_AVAILABLE;
+		}
+
+		_controlROM = MT32Emu::ROMImage::makeROMImage(&_controlFile);
+		_pcmROM = MT32Emu::ROMImage::makeROMImage(&_pcmFile);
+		_synth = new MT32Emu::Synth();
+		if (!_synth->open(*_controlROM, *_pcmROM))
+			return MERR_DEVICE_NOT_AVAILABLE;
+
+		MidiDriver_Emulated::open();
+		_mixer->playStream(Audio::Mixer::kPlainSoundType, &_mixerSoundHandle, this, -1, Audio::Mixer::kMaxChannelVolume, 0, DisposeAfterUse::NO, true);
+		return 0;
+	}
+
+	void close() {
+		_mixer->stopHandle(_mixerSoundHandle);
+		_synth->close();
+	}
+
+	void send(uint32 b) { _synth->playMsg(b); }
+	void sysEx(const byte *msg, uint16 length) { _synth->playSysexWithoutFraming(msg, length); }
+
+	MidiChannel *allocateChannel() { return 0; }
+	MidiChannel *getPercussionChannel() { return 0; }
+
+	bool isStereo() const { return true; }
+	int getRate() const { return 32000; }
+
+protected:
+	void generateSamples(int16 *buf, int len) { _synth->render(buf, len); }
+
+private:
+	Common::String _romPath;
+	MT32Emu::Synth *_synth;
+	const MT32Emu::ROMImage *_controlROM, *_pcmROM;
+	Common::File _controlFile, _pcmFile;
+};
+#endif
+
+#pragma mark -
+#pragma mark --- Main ---
+#pragma mark -
+
+static void printHelp() {
+	printf("Usage: synthbench [options] --synth=<synth> <input>\n\n");
+	printf("Synths:\n");
+	printf("  opl-mame, opl-db   OPL emulators, input is a DOSBox raw OPL capture (.dro)\n");
+	printf("                     or a text register stream\n");
+	printf("  cms                Creative Music System, input is a text register stream\n");
+	printf("  adlib-mame, adlib-db\n");
+	printf("                     AdLib MIDI driver on the given OPL emulator, input is a MIDI file\n");
+	printf("  towns              FM-Towns MIDI driver, input is a MIDI file\n");
+#ifdef USE_MT32EMU
+	printf("  mt32               MT-32 emulator, input is a MIDI file, see --rom-path\n");
+#endif
+	printf("\nText register streams hold one write per line: <delay ms> <register hex> <value hex>\n");
+	printf("\nOptions:\n");
+	printf("  --rate=<hz>          Mixer output rate (default: 44100)\n");
+	printf("  --period=<frames>    Frames per mixer callback (default: 1024)\n");
+	printf("  --length=<seconds>   Maximum length to render (default: 600)\n");
+	printf("  --output=<file>      Write the output as raw signed 16 bit little endian stereo PCM\n");
+	printf("  --reference=<file>   Compare the MD5 of the output with the one stored in the file\n");
+	printf("  --update-reference   Store the MD5 of the output in the reference file instead\n");
+	printf("  --rom-path=<dir>     Directory of the MT-32 ROMs (default: .)\n");
+}
+
+static bool parseOption(const char *arg, const char *name, Common::String &value) {
+	const size_t len = strlen(name);
+	if (strncmp(arg, name, len) || arg[len] != '=')
+		return false;
+	value = arg + len + 1;
+	return true;
+}
+
+int main(int argc, char *argv[]) {
+	Common::String synth, input, output, reference, romPath(".");
+	Common::String value;
+	uint rate = 44100;
+	uint period = 1024;
+	uint maxLength = 600;
+	bool updateReference = false;
+
+	for (int i = 1; i < argc; ++i) {
+		if (parseOption(argv[i], "--synth", synth) || parseOption(argv[i], "--output", output)
+		    || parseOption(argv[i], "--reference", reference) || parseOption(argv[i], "--rom-path", romPath)) {
+			continue;
+		} else if (parseOption(argv[i], "--rate", value)) {
+			rate = atoi(value.c_str());
+		} else if (parseOption(argv[i], "--period", value)) {
+			period = atoi(value.c_str());
+		} else if (parseOption(argv[i], "--length", value)) {
+			maxLength = atoi(value.c_str());
+		} else if (!strcmp(argv[i], "--update-reference")) {
+			updateReference = true;
+		} else if (argv[i][0] == '-') {
+			printHelp();
+			return 1;
+		} else {
+			input = argv[i];
+		}
+	}
+
+	if (synth.empty() || input.empty() || !rate || !period) {
+		printHelp();
+		return 1;
+	}
+
+	uint32 size;
+	byte *data = loadFile(input.c_str(), size);
+	if (!data) {
+		fprintf(stderr, "Could not read '%s'\n", input.c_str());
+		return 1;
+	}
+
+	BenchSystem *system = new BenchSystem(rate);
+	Audio::MixerImpl *mixer = system->getMixerImpl();
+
+	RegisterStream registers;
+	RegisterStreamPlayer *player = 0;
+	MidiDriver *driver = 0;
+	MidiParser *parser = 0;
+
+	if (synth.hasPrefix("opl-") || synth == "cms") {
+		OPL::Config::OplType type = OPL::Config::kOpl2;
+		bool parsed;
+		if (size >= 8 && !memcmp(data, "DBRAWOPL", 8))
+			parsed = synth != "cms" && parseDRO(data, size, registers, type);
+		else
+			parsed = parseTextRegisters(data, size, registers);
+		if (!parsed)
+			return 1;
+
+		RegisterChip *chip;
+		if (synth == "cms") {
+			chip = new CMSChip(rate);
+		} else {
+			OPL::OPL *opl = OPL::Config::create(OPL::Config::parse(synth.c_str() + 4), type);
+			if (!opl || !opl->init(rate)) {
+				fprintf(stderr, "Could not create OPL emulator '%s' for this capture\n", synth.c_str() + 4);
+				return 1;
+			}
+			chip = new OPLChip(opl, type);
+		}
+
+		player = new RegisterStreamPlayer(chip, registers, rate);
+		Audio::SoundHandle handle;
+		system->getMixer()->playStream(Audio::Mixer::kPlainSoundType, &handle, player, -1, Audio::Mixer::kMaxChannelVolume, 0, DisposeAfterUse::NO);
+	} else {
+		if (synth.hasPrefix("adlib-")) {
+			ConfMan.set("opl_driver", synth.c_str() + 6);
+			((MusicPluginObject *)g_ADLIB_getObject())->createInstance(&driver);
+		} else if (synth == "towns") {
+			driver = new MidiDriver_TOWNS(mixer);
+#ifdef USE_MT32EMU
+		} else if (synth == "mt32") {
+			driver = new MidiDriver_BenchMT32(mixer, romPath);
+#endif
+		}
+
+		if (!driver) {
+			fprintf(stderr, "Unknown synth '%s'\n", synth.c_str());
+			return 1;
+		}
+		if (driver->open()) {
+			fprintf(stderr, "Could not open the '%s' driver\n", synth.c_str());
+			return 1;
+		}
+
+		parser = MidiParser::createParser_SMF();
+		if (!parser->loadMusic(data, size)) {
+			fprintf(stderr, "Could not parse MIDI file '%s'\n", input.c_str());
+			return 1;
+		}
+		parser->setMidiDriver(driver);
+		parser->setTimerRate(driver->getBaseTempo());
+		driver->setTimerCallback(parser, &MidiParser::timerCallback);
+	}
+
+	FILE *outputFile = 0;
+	if (!output.empty()) {
+		outputFile = fopen(output.c_str(), "wb");
+		if (!outputFile) {
+			fprintf(stderr, "Could not open '%s' for writing\n", output.c_str());
+			return 1;
+		}
+	}
+
+	// Render until the input is done, plus a second for MIDI notes to decay
+	int16 *buffer = new int16[period * 2];
+	Common::MemoryWriteStreamDynamic rendered(DisposeAfterUse::YES);
+	Common::Array<uint32> callbackTimes;
+	const uint32 maxFrames = maxLength * rate;
+	uint32 frames = 0;
+	uint32 tail = rate;
+
+	while (frames < maxFrames && tail > 0) {
+		const uint32 start = getMicros();
+		mixer->mixCallback((byte *)buffer, period * 4);
+		callbackTimes.push_back(getMicros() - start);
+
+		for (uint i = 0; i < period * 2; ++i)
+			WRITE_LE_UINT16(buffer + i, buffer[i]);
+		rendered.write(buffer, period * 4);
+		if (outputFile)
+			fwrite(buffer, 4, period, outputFile);
+
+		frames += period;
+		if (player ? player->endOfData() : !parser->isPlaying())
+			tail = (tail > period) ? tail - period : 0;
+	}
+
+	if (outputFile)
+		fclose(outputFile);
+	delete[] buffer;
+
+	// Statistics
+	uint64 total = 0;
+	for (uint i = 0; i < callbackTimes.size(); ++i)
+		total += callbackTimes[i];
+	Common::sort(callbackTimes.begin(), callbackTimes.end());
+
+	const double seconds = (double)frames / rate;
+	const double budget = 1000000.0 * period / rate;
+	printf("Rendered %.1f seconds in %u callbacks of %u frames\n", seconds, callbackTimes.size(), period);
+	printf("Real-time factor: %.1fx\n", total ? seconds * 1000000.0 / total : 0.0);
+	printf("Callback time (us): p50 %u, p90 %u, p99 %u, max %u (budget %.0f)\n",
+	       callbackTimes[callbackTimes.size() / 2], callbackTimes[callbackTimes.size() * 9 / 10],
+	       callbackTimes[callbackTimes.size() * 99 / 100], callbackTimes.back(), budget);
+
+	Common::MemoryReadStream renderedStream(rendered.getData(), rendered.size());
+	const Common::String md5 = Common::computeStreamMD5AsString(renderedStream);
+	printf("Output MD5: %s\n", md5.c_str());
+
+	int result = 0;
+	if (!reference.empty()) {
+		if (updateReference) {
+			FILE *file = fopen(reference.c_str(), "w");
+			if (file) {
+				fprintf(file, "%s\n", md5.c_str());
+				fclose(file);
+			}
+		} else {
+			uint32 refSize;
+			byte *refData = loadFile(reference.c_str(), refSize);
+			if (!refData || refSize < 32 || memcmp(refData, md5.c_str(), 32)) {
+				printf("Output does NOT match the reference\n");
+				result = 2;
+			} else {
+				printf("Output matches the reference\n");
+			}
+			delete[] refData;
+		}
+	}
+
+	if (driver) {
+		driver->setTimerCallback(0, 0);
+		driver->close();
+	}
+	delete parser;
+	delete driver;
+	mixer->stopAll();
+	delete player;
+	delete[] data;
+	return result;
+}
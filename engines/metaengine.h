@@ -112,6 +112,24 @@ public:
 		return SaveStateList();
 	}
 
+	/**
+	 * Return the pattern matching all savefiles of the specified target, as
+	 * passed to SaveFileManager::listSavefiles().
+	 *
+	 * The result of listSaves() must only depend on the savefiles matching
+	 * it. This allows the GUI to reuse the save state list as long as none
+	 * of these savefiles changed.
+	 *
+	 * The default implementation returns an empty string, i.e. there is no
+	 * such pattern and the save state list is never reused.
+	 *
+	 * @param target	name of a config manager target
+	 * @return			the savefile pattern of the target
+	 */
+	virtual Common::String getSavegameFilePattern(const char *target) const {
+		return Common::String();
+	}
+
 	/**
 	 * Return a list of extra GUI options for the specified target.
 	 * If no target is specified, all of the available custom GUI options are
@@ -112,6 +112,7 @@ Console::Console(SciEngine *engine) : GUI::Debugger(),
 	registerCmd("resource_id",		WRAP_METHOD(Console, cmdResourceId));
 	registerCmd("resource_info",		WRAP_METHOD(Console, cmdResourceInfo));
 	registerCmd("resource_types",		WRAP_METHOD(Console, cmdResourceTypes));
+	registerCmd("resource_stats",		WRAP_METHOD(Console, cmdResourceStats));
 	registerCmd("list",				WRAP_METHOD(Console, cmdList));
 	registerCmd("hexgrep",			WRAP_METHOD(Console, cmdHexgrep));
 	registerCmd("verify_scripts",		WRAP_METHOD(Console, cmdVerifyScripts));
@@ -139,6 +140,7 @@ Console::Console(SciEngine *engine) : GUI::Debugger(),
 	registerCmd("pl",                 WRAP_METHOD(Console, cmdPlaneList));	// alias
 	registerCmd("plane_items",        WRAP_METHOD(Console, cmdPlaneItemList));
 	registerCmd("pi",                 WRAP_METHOD(Console, cmdPlaneItemList));	// alias
+	registerCmd("frame_stats",        WRAP_METHOD(Console, cmdFrameStats));
 	registerCmd("saved_bits",         WRAP_METHOD(Console, cmdSavedBits));
 	registerCmd("show_saved_bits",    WRAP_METHOD(Console, cmdShowSavedBits));
 	// Segments
@@ -351,6 +353,7 @@ bool Console::cmdHelp(int argc, const char **argv) {
 	debugPrintf(" resource_id - Identifies a resource number by splitting it up in resource type and resource number\n");
 	debugPrintf(" resource_info - Shows info about a resource\n");
 	debugPrintf(" resource_types - Shows the valid resource types\n");
+	debugPrintf(" resource_stats - Shows resource cache statistics\n");
 	debugPrintf(" list - Lists all the resources of a given type\n");
 	debugPrintf(" hexgrep - Searches some resources for a particular sequence of bytes, represented as hexadecimal numbers\n");
 	debugPrintf(" verify_scripts - Performs sanity checks on SCI1.1-SCI2.1 game scripts (e.g. if they're up to 64KB in total)\n");
@@ -376,6 +379,7 @@ bool Console::cmdHelp(int argc, const char **argv) {
 	debugPrintf(" window_list / wl - Shows a list of all the windows (ports) in the draw list (SCI0 - SCI1.1)\n");
 	debugPrintf(" plane_list / pl - Shows a list of all the planes in the draw list (SCI2+)\n");
 	debugPrintf(" plane_items / pi - Shows a list of all items for a plane (SCI2+)\n");
+	debugPrintf(" frame_stats - Shows frame timing and screen update statistics (SCI2+)\n");
 	debugPrintf(" saved_bits - List saved bits on the hunk\n");
 	debugPrintf(" show_saved_bits - Display saved bits\n");
 	debugPrintf("\n");
@@ -812,6 +816,34 @@ bool Console::cmdResourceTypes(int argc, const char **argv) {
 	return true;
 }
 
+bool Console::cmdResourceStats(int argc, const char **argv) {
+	if (argc > 2 || (argc == 2 && strcmp(argv[1], "reset"))) {
+		debugPrintf("Shows resource cache statistics\n");
+		debugPrintf("Usage: %s [reset]\n", argv[0]);
+		return true;
+	}
+
+	ResourceManager *resMan = _engine->getResMan();
+
+	if (argc == 2) {
+		resMan->resetLRUStats();
+		debugPrintf("Resource cache statistics have been reset\n");
+		return true;
+	}
+
+	const ResourceManager::LRUStats &stats = resMan->getLRUStats();
+	const uint32 requests = stats.hits + stats.loads;
+
+	debugPrintf("Cache budget: %d KB, in use: %d KB, locked: %d KB\n",
+				resMan->getMaxMemoryLRU() / 1024, resMan->getMemoryLRU() / 1024, resMan->getMemoryLocked() / 1024);
+	debugPrintf("Requests: %d, hits: %d (%d%%), loads: %d, evictions: %d\n",
+				requests, stats.hits, requests ? stats.hits * 100 / requests : 0, stats.loads, stats.evictions);
+	debugPrintf("Load time: %d ms total, %d ms average\n",
+				stats.loadTime, stats.loads ? stats.loadTime / stats.loads : 0);
+
+	return true;
+}
+
 bool Console::cmdHexgrep(int argc, const char **argv) {
 	if (argc < 4) {
 		debugPrintf("Searches some resources for a particular sequence of bytes, represented as decimal or hexadecimal numbers.\n");
@@ -1667,6 +1699,19 @@ bool Console::cmdPlaneList(int argc, const char **argv) {
 	return true;
 }
 
+bool Console::cmdFrameStats(int argc, const char **argv) {
+#ifdef ENABLE_SCI32
+	if (_engine->_gfxFrameout) {
+		_engine->_gfxFrameout->printFrameStats(this);
+	} else {
+		debugPrintf("This SCI version does not use kFrameout\n");
+	}
+#else
+	debugPrintf("SCI32 isn't included in this compiled executable\n");
+#endif
+	return true;
+}
+
 bool Console::cmdPlaneItemList(int argc, const char **argv) {
 	if (argc != 2) {
 		debugPrintf("Shows the list of items for a plane\n");
@@ -197,6 +197,8 @@ reg_t kGetEvent(EngineState *s, int argc, reg_t *argv) {
 	// #3037874. Make sure that we're not delaying while the game is
 	// benchmarking, as that will affect the final benchmarked result -
 	// check bugs #3058865 and #3127824
+	// This has to be a full delay rather than a wait for input, since
+	// scripts polling kGetEvent would otherwise spin while the mouse moves.
 	if (s->_gameIsBenchmarking) {
 		// Game is benchmarking, don't add a delay
 	} else {
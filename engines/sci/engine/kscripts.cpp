@@ -42,6 +42,11 @@ reg_t kLoad(EngineState *s, int argc, reg_t *argv) {
 	if (restype == kResourceTypeMemory)
 		return s->_segMan->allocateHunkEntry("kLoad()", resnr);
 
+	// We load resources on demand, but scripts usually announce what they are
+	// going to need (e.g. the views and pics of the next room), so use this to
+	// load them ahead of time while the engine is idle
+	g_sci->getResMan()->prefetchResource(ResourceId(restype, resnr));
+
 	return make_reg(0, ((restype << 11) | resnr)); // Return the resource identifier as handle
 }
 
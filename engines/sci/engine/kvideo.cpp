@@ -52,6 +52,9 @@ void playVideo(Video::VideoDecoder *videoDecoder, VideoState videoState) {
 
 	videoDecoder->start();
 
+	// The video is drawn directly onto the backend screen
+	g_sci->_gfxScreen->invalidateLastCopy();
+
 	byte *scaleBuffer = 0;
 	byte bytesPerPixel = videoDecoder->getPixelFormat().bytesPerPixel;
 	uint16 width = videoDecoder->getWidth();
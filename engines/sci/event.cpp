@@ -332,14 +332,18 @@ void SciEngine::sleep(uint32 msecs) {
 		// let backend process events and update the screen
 		_eventMan->getSciEvent(SCI_EVENT_PEEK);
 		time = g_system->getMillis();
-		if (time + 10 < wakeup_time) {
-			g_system->delayMillis(10);
-		} else {
-			if (time < wakeup_time)
-				g_system->delayMillis(wakeup_time - time);
+		if (time >= wakeup_time)
 			break;
-		}
 
+		// Use the idle time to load resources which scripts have asked for
+		// in advance, as long as they are expected to load in time. A bit of
+		// time is kept in reserve for the estimate being off.
+		if (wakeup_time - time > 2 && _resMan->prefetchNext(wakeup_time - time - 2))
+			continue;
+
+		// Wake up early when an event arrives, so that it gets processed
+		// (and e.g. the mouse cursor gets updated) right away.
+		g_system->waitForEvent(wakeup_time - time);
 	}
 }
 
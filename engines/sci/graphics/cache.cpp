@@ -35,12 +35,14 @@
 namespace Sci {
 
 GfxCache::GfxCache(ResourceManager *resMan, GfxScreen *screen, GfxPalette *palette)
-	: _resMan(resMan), _screen(screen), _palette(palette) {
+	: _resMan(resMan), _screen(screen), _palette(palette), _cachedCelsSize(0), _cachedCelsCounter(0) {
 }
 
 GfxCache::~GfxCache() {
 	purgeFontCache();
+	// Views hand their cels over to the cel cache, so purge that one last
 	purgeViewCache();
+	purgeCelCache();
 }
 
 void GfxCache::purgeFontCache() {
@@ -61,6 +63,66 @@ void GfxCache::purgeViewCache() {
 	_cachedViews.clear();
 }
 
+void GfxCache::purgeCelCache() {
+	for (CelBitmapCache::iterator iter = _cachedCels.begin(); iter != _cachedCels.end(); ++iter)
+		delete[] iter->_value.bitmap;
+
+	_cachedCels.clear();
+	_cachedCelsSize = 0;
+}
+
+void GfxCache::freeCelBitmap(CelBitmapCache::iterator iter) {
+	delete[] iter->_value.bitmap;
+	_cachedCelsSize -= iter->_value.size;
+	_cachedCels.erase(iter);
+}
+
+static inline uint32 getCelCacheKey(GuiResourceId viewId, int16 loopNo, int16 celNo) {
+	return ((uint32)(viewId & 0xFFFF) << 16) | ((loopNo & 0xFF) << 8) | (celNo & 0xFF);
+}
+
+byte *GfxCache::takeCelBitmap(GuiResourceId viewId, int16 loopNo, int16 celNo, uint32 size) {
+	CelBitmapCache::iterator iter = _cachedCels.find(getCelCacheKey(viewId, loopNo, celNo));
+	if (iter == _cachedCels.end())
+		return NULL;
+
+	byte *bitmap = NULL;
+	if (iter->_value.size == size) {
+		bitmap = iter->_value.bitmap;
+		iter->_value.bitmap = NULL;
+	}
+	freeCelBitmap(iter);
+	return bitmap;
+}
+
+void GfxCache::storeCelBitmap(GuiResourceId viewId, int16 loopNo, int16 celNo, byte *bitmap, uint32 size) {
+	// Loop and cel numbers above 255 don't fit into the key
+	if (loopNo > 0xFF || celNo > 0xFF || size > MAX_CACHED_CEL_BYTES) {
+		delete[] bitmap;
+		return;
+	}
+
+	const uint32 key = getCelCacheKey(viewId, loopNo, celNo);
+	CelBitmapCache::iterator iter = _cachedCels.find(key);
+	if (iter != _cachedCels.end())
+		freeCelBitmap(iter);
+
+	while (!_cachedCels.empty() && _cachedCelsSize + size > MAX_CACHED_CEL_BYTES) {
+		CelBitmapCache::iterator oldest = _cachedCels.begin();
+		for (iter = _cachedCels.begin(); iter != _cachedCels.end(); ++iter) {
+			if (iter->_value.lastUsed < oldest->_value.lastUsed)
+				oldest = iter;
+		}
+		freeCelBitmap(oldest);
+	}
+
+	CachedCelBitmap &entry = _cachedCels[key];
+	entry.bitmap = bitmap;
+	entry.size = size;
+	entry.lastUsed = _cachedCelsCounter++;
+	_cachedCelsSize += size;
+}
+
 GfxFont *GfxCache::getFont(GuiResourceId fontId) {
 	if (_cachedFonts.size() >= MAX_CACHED_FONTS)
 		purgeFontCache();
@@ -81,7 +143,7 @@ GfxView *GfxCache::getView(GuiResourceId viewId) {
 		purgeViewCache();
 
 	if (!_cachedViews.contains(viewId))
-		_cachedViews[viewId] = new GfxView(_resMan, _screen, _palette, viewId);
+		_cachedViews[viewId] = new GfxView(_resMan, _screen, _palette, viewId, this);
 
 	return _cachedViews[viewId];
 }
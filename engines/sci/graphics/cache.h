@@ -33,6 +33,14 @@ class GfxView;
 typedef Common::HashMap<int, GfxFont *> FontCache;
 typedef Common::HashMap<int, GfxView *> ViewCache;
 
+struct CachedCelBitmap {
+	byte *bitmap;
+	uint32 size;
+	uint32 lastUsed;
+};
+
+typedef Common::HashMap<uint32, CachedCelBitmap> CelBitmapCache;
+
 /**
  * Cache class, handles caching of views/fonts
  */
@@ -51,9 +59,25 @@ public:
 
 	byte kernelViewGetColorAtCoordinate(GuiResourceId viewId, int16 loopNo, int16 celNo, int16 x, int16 y);
 
+	/**
+	 * Takes an unpacked cel bitmap out of the cel cache. The caller becomes
+	 * the owner of the returned bitmap, which must be size bytes big.
+	 * @return the bitmap, or NULL if it wasn't cached
+	 */
+	byte *takeCelBitmap(GuiResourceId viewId, int16 loopNo, int16 celNo, uint32 size);
+
+	/**
+	 * Hands an unpacked cel bitmap over to the cel cache, so that it survives
+	 * the view it belongs to getting purged. Least recently stored bitmaps
+	 * are freed once the cache exceeds MAX_CACHED_CEL_BYTES.
+	 */
+	void storeCelBitmap(GuiResourceId viewId, int16 loopNo, int16 celNo, byte *bitmap, uint32 size);
+
 private:
 	void purgeFontCache();
 	void purgeViewCache();
+	void purgeCelCache();
+	void freeCelBitmap(CelBitmapCache::iterator iter);
 
 	ResourceManager *_resMan;
 	GfxScreen *_screen;
@@ -61,6 +85,10 @@ private:
 
 	FontCache _cachedFonts;
 	ViewCache _cachedViews;
+
+	CelBitmapCache _cachedCels;
+	uint32 _cachedCelsSize;
+	uint32 _cachedCelsCounter;
 };
 
 } // End of namespace Sci
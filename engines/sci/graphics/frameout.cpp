@@ -66,6 +66,12 @@ GfxFrameout::GfxFrameout(SegManager *segMan, ResourceManager *resMan, GfxCoordAd
 	_curScrollText = -1;
 	_showScrollText = false;
 	_maxScrollTexts = 0;
+
+	_frameCount = 0;
+	_frameTimeTotal = 0;
+	_frameTimeLast = 0;
+	_frameTimeMax = 0;
+	_frameCopiedPixels = 0;
 }
 
 GfxFrameout::~GfxFrameout() {
@@ -532,6 +538,9 @@ void GfxFrameout::showVideo() {
 	if (videoDecoder->hasDirtyPalette())
 		g_system->getPaletteManager()->setPalette(videoDecoder->getPalette(), 0, 256);
 
+	// The video is drawn directly onto the backend screen
+	_screen->invalidateLastCopy();
+
 	while (!g_engine->shouldQuit() && !videoDecoder->endOfVideo() && !skipVideo) {
 		if (videoDecoder->needsUpdate()) {
 			const Graphics::Surface *frame = videoDecoder->decodeNextFrame();
@@ -555,15 +564,16 @@ void GfxFrameout::showVideo() {
 				skipVideo = true;
 		}
 
-		g_system->delayMillis(10);
+		// Use the time until the next frame is due to decode it
+		if (!videoDecoder->decodeAhead())
+			g_system->delayMillis(10);
 	}
 }
 
 void GfxFrameout::createPlaneItemList(reg_t planeObject, FrameoutList &itemList) {
 	// Copy screen items of the current frame to the list of items to be drawn
 	for (FrameoutList::iterator listIterator = _screenItems.begin(); listIterator != _screenItems.end(); listIterator++) {
-		reg_t itemPlane = readSelector(_segMan, (*listIterator)->object, SELECTOR(plane));
-		if (planeObject == itemPlane) {
+		if (planeObject == (*listIterator)->plane) {
 			kernelUpdateScreenItem((*listIterator)->object);	// TODO: Why is this necessary?
 			itemList.push_back(*listIterator);
 		}
@@ -657,8 +667,17 @@ void GfxFrameout::kernelFrameout() {
 		return;
 	}
 
+	const uint32 frameStartTime = g_system->getMillis();
+
 	_palette->palVaryUpdate();
 
+	// Look up the plane of every screen item once, instead of once per plane
+	// when the item lists get created
+	if (!_planes.empty()) {
+		for (FrameoutList::iterator listIterator = _screenItems.begin(); listIterator != _screenItems.end(); listIterator++)
+			(*listIterator)->plane = readSelector(_segMan, (*listIterator)->object, SELECTOR(plane));
+	}
+
 	for (PlaneList::iterator it = _planes.begin(); it != _planes.end(); it++) {
 		reg_t planeObject = it->object;
 
@@ -849,9 +868,15 @@ void GfxFrameout::kernelFrameout() {
 
 	showCurrentScrollText();
 
-	_screen->copyToScreen();
+	// Only send the parts of the screen that actually changed to the backend
+	_frameCopiedPixels = _screen->copyChangedToScreen();
 
 	g_sci->getEngineState()->_throttleTrigger = true;
+
+	_frameTimeLast = g_system->getMillis() - frameStartTime;
+	_frameTimeTotal += _frameTimeLast;
+	_frameTimeMax = MAX(_frameTimeMax, _frameTimeLast);
+	_frameCount++;
 }
 
 void GfxFrameout::printPlaneList(Console *con) {
@@ -882,6 +907,13 @@ void GfxFrameout::printPlaneList(Console *con) {
 	}
 }
 
+void GfxFrameout::printFrameStats(Console *con) {
+	con->debugPrintf("Frames: %d, last frame: %d ms, average: %d ms, slowest: %d ms\n",
+						_frameCount, _frameTimeLast, _frameCount ? _frameTimeTotal / _frameCount : 0, _frameTimeMax);
+	con->debugPrintf("Pixels copied to screen in last frame: %d of %d\n",
+						_frameCopiedPixels, _screen->getDisplayWidth() * _screen->getDisplayHeight());
+}
+
 void GfxFrameout::printPlaneItemList(Console *con, reg_t planeObject) {
 	for (FrameoutList::iterator listIterator = _screenItems.begin(); listIterator != _screenItems.end(); listIterator++) {
 		FrameoutEntry *e = *listIterator;
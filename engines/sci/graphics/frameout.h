@@ -73,6 +73,7 @@ struct FrameoutEntry {
 	int16 picStartX;
 	int16 picStartY;
 	bool visible;
+	reg_t plane; // plane object this item was on when the frame was last drawn
 };
 
 typedef Common::List<FrameoutEntry *> FrameoutList;
@@ -150,6 +151,7 @@ public:
 
 	void printPlaneList(Console *con);
 	void printPlaneItemList(Console *con, reg_t planeObject);
+	void printFrameStats(Console *con);
 
 private:
 	void showVideo();
@@ -173,6 +175,13 @@ private:
 	bool _showScrollText;
 	uint16 _maxScrollTexts;
 
+	// Frame statistics, shown by the "frame_stats" console command
+	uint32 _frameCount;
+	uint32 _frameTimeTotal;
+	uint32 _frameTimeLast;
+	uint32 _frameTimeMax;
+	uint _frameCopiedPixels;
+
 	void sortPlanes();
 };
 
@@ -52,6 +52,7 @@ GfxPaint16::GfxPaint16(ResourceManager *resMan, SegManager *segMan, GfxCache *ca
 }
 
 GfxPaint16::~GfxPaint16() {
+	purgePictureCache();
 }
 
 void GfxPaint16::init(GfxAnimate *animate, GfxText16 *text16) {
@@ -70,7 +71,21 @@ void GfxPaint16::drawPicture(GuiResourceId pictureId, int16 animationNr, bool mi
 	if (!addToFlag)
 		clearScreen(_screen->getColorWhite());
 
-	picture->draw(animationNr, mirroredFlag, addToFlag, paletteId);
+	// Vector pictures which are drawn onto a cleared port covering the lower
+	// right part of the screen always end up the same, so we can cache them
+	Common::Rect cacheRect = _ports->_curPort->rect;
+	_ports->offsetRect(cacheRect);
+	bool cacheable = !addToFlag && !_EGAdrawingVisualize && picture->isVectorPicture() &&
+		_screen->getUpscaledHires() != GFX_SCREEN_UPSCALED_480x300 &&
+		cacheRect.right == _screen->getScriptWidth() && cacheRect.bottom == _screen->getScriptHeight() &&
+		cacheRect.left >= 0 && cacheRect.top >= 0;
+
+	if (!cacheable) {
+		picture->draw(animationNr, mirroredFlag, addToFlag, paletteId);
+	} else if (!restoreCachedPicture(picture, cacheRect, mirroredFlag, paletteId)) {
+		picture->draw(animationNr, mirroredFlag, addToFlag, paletteId);
+		storeCachedPicture(pictureId, cacheRect, mirroredFlag, paletteId);
+	}
 	delete picture;
 
 	// We make a call to SciPalette here, for increasing sys timestamp and also loading targetpalette, if palvary active
@@ -79,6 +94,69 @@ void GfxPaint16::drawPicture(GuiResourceId pictureId, int16 animationNr, bool mi
 		_palette->drewPicture(pictureId);
 }
 
+bool GfxPaint16::restoreCachedPicture(GfxPicture *picture, const Common::Rect &rect, bool mirroredFlag, int16 EGApaletteNo) {
+	const bool undithering = _screen->isUnditheringEnabled();
+
+	for (PictureCache::iterator it = _cachedPictures.begin(); it != _cachedPictures.end(); ++it) {
+		if (it->pictureId != picture->getResourceId() || it->mirroredFlag != mirroredFlag ||
+			it->EGApaletteNo != EGApaletteNo || it->undithering != undithering || it->rect != rect)
+			continue;
+
+		// The vector data may still change the palette and priority bands
+		picture->drawState(mirroredFlag, EGApaletteNo);
+
+		_screen->bitsRestore(it->bits);
+		int16 *ditheredPicColors = _screen->unditherGetDitheredBgColors();
+		if (ditheredPicColors && it->ditheredPicColors)
+			memcpy(ditheredPicColors, it->ditheredPicColors, DITHERED_BG_COLORS_SIZE * sizeof(int16));
+
+		// Move to the front, so that it gets purged last
+		if (it != _cachedPictures.begin()) {
+			CachedPicture entry = *it;
+			_cachedPictures.erase(it);
+			_cachedPictures.push_front(entry);
+		}
+		return true;
+	}
+
+	return false;
+}
+
+void GfxPaint16::storeCachedPicture(GuiResourceId pictureId, const Common::Rect &rect, bool mirroredFlag, int16 EGApaletteNo) {
+	if (_cachedPictures.size() >= MAX_CACHED_PICTURES) {
+		CachedPicture &oldest = _cachedPictures.back();
+		delete[] oldest.bits;
+		delete[] oldest.ditheredPicColors;
+		_cachedPictures.pop_back();
+	}
+
+	CachedPicture entry;
+	entry.pictureId = pictureId;
+	entry.mirroredFlag = mirroredFlag;
+	entry.EGApaletteNo = EGApaletteNo;
+	entry.undithering = _screen->isUnditheringEnabled();
+	entry.rect = rect;
+	entry.bits = new byte[_screen->bitsGetDataSize(rect, GFX_SCREEN_MASK_ALL)];
+	_screen->bitsSave(rect, GFX_SCREEN_MASK_ALL, entry.bits);
+	entry.ditheredPicColors = NULL;
+
+	const int16 *ditheredPicColors = _screen->unditherGetDitheredBgColors();
+	if (ditheredPicColors) {
+		entry.ditheredPicColors = new int16[DITHERED_BG_COLORS_SIZE];
+		memcpy(entry.ditheredPicColors, ditheredPicColors, DITHERED_BG_COLORS_SIZE * sizeof(int16));
+	}
+
+	_cachedPictures.push_front(entry);
+}
+
+void GfxPaint16::purgePictureCache() {
+	for (PictureCache::iterator it = _cachedPictures.begin(); it != _cachedPictures.end(); ++it) {
+		delete[] it->bits;
+		delete[] it->ditheredPicColors;
+	}
+	_cachedPictures.clear();
+}
+
 // This one is the only one that updates screen!
 void GfxPaint16::drawCelAndShow(GuiResourceId viewId, int16 loopNo, int16 celNo, uint16 leftPos, uint16 topPos, byte priority, uint16 paletteNo, uint16 scaleX, uint16 scaleY) {
 	GfxView *view = _cache->getView(viewId);
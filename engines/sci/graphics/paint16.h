@@ -23,6 +23,8 @@
 #ifndef SCI_GRAPHICS_PAINT16_H
 #define SCI_GRAPHICS_PAINT16_H
 
+#include "common/list.h"
+
 #include "sci/graphics/paint.h"
 
 namespace Sci {
@@ -32,6 +34,23 @@ class GfxScreen;
 class GfxPalette;
 class Font;
 class GfxView;
+class GfxPicture;
+
+/**
+ * A vector picture as it ended up on screen, so that it doesn't need to get
+ * drawn again when a room is revisited
+ */
+struct CachedPicture {
+	GuiResourceId pictureId;
+	bool mirroredFlag;
+	int16 EGApaletteNo;
+	bool undithering;
+	Common::Rect rect;
+	byte *bits;
+	int16 *ditheredPicColors;
+};
+
+typedef Common::List<CachedPicture> PictureCache;
 
 /**
  * Paint16 class, handles painting/drawing for SCI16 (SCI0-SCI1.1) games
@@ -101,6 +120,13 @@ private:
 
 	// true means make EGA picture drawing visible
 	bool _EGAdrawingVisualize;
+
+	// most recently drawn vector pictures, most recent one first
+	PictureCache _cachedPictures;
+
+	bool restoreCachedPicture(GfxPicture *picture, const Common::Rect &rect, bool mirroredFlag, int16 EGApaletteNo);
+	void storeCachedPicture(GuiResourceId pictureId, const Common::Rect &rect, bool mirroredFlag, int16 EGApaletteNo);
+	void purgePictureCache();
 };
 
 } // End of namespace Sci
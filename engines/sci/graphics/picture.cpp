@@ -36,7 +36,7 @@ namespace Sci {
 //#define DEBUG_PICTURE_DRAW
 
 GfxPicture::GfxPicture(ResourceManager *resMan, GfxCoordAdjuster *coordAdjuster, GfxPorts *ports, GfxScreen *screen, GfxPalette *palette, GuiResourceId resourceId, bool EGAdrawingVisualize)
-	: _resMan(resMan), _coordAdjuster(coordAdjuster), _ports(ports), _screen(screen), _palette(palette), _resourceId(resourceId), _EGAdrawingVisualize(EGAdrawingVisualize) {
+	: _resMan(resMan), _coordAdjuster(coordAdjuster), _ports(ports), _screen(screen), _palette(palette), _resourceId(resourceId), _EGAdrawingVisualize(EGAdrawingVisualize), _stateOnly(false) {
 	assert(resourceId != -1);
 	initData(resourceId);
 }
@@ -87,6 +87,31 @@ void GfxPicture::draw(int16 animationNr, bool mirroredFlag, bool addToFlag, int1
 	}
 }
 
+bool GfxPicture::isVectorPicture() const {
+	switch (READ_LE_UINT16(_resource->data)) {
+	case 0x26: // SCI 1.1 VGA picture
+	case 0x0e: // SCI32 VGA picture
+		return false;
+	default:
+		return true;
+	}
+}
+
+void GfxPicture::drawState(bool mirroredFlag, int16 EGApaletteNo) {
+	assert(isVectorPicture());
+
+	_animationNr = -1;
+	_mirroredFlag = mirroredFlag;
+	_addToFlag = false;
+	_EGApaletteNo = EGApaletteNo;
+	_priority = 0;
+	_resourceType = SCI_PICTURE_TYPE_REGULAR;
+
+	_stateOnly = true;
+	drawVectorData(_resource->data, _resource->size);
+	_stateOnly = false;
+}
+
 void GfxPicture::reset() {
 	int16 startY = _ports->getPort()->top;
 	int16 startX = 0;
@@ -636,7 +661,8 @@ void GfxPicture::drawVectorData(byte *data, int dataSize) {
 				Common::Point startPoint(oldx, oldy);
 				Common::Point endPoint(x, y);
 				_ports->offsetLine(startPoint, endPoint);
-				_screen->drawLine(startPoint, endPoint, pic_color, pic_priority, pic_control);
+				if (!_stateOnly)
+					_screen->drawLine(startPoint, endPoint, pic_color, pic_priority, pic_control);
 			}
 			break;
 		case PIC_OP_MEDIUM_LINES: // medium line
@@ -656,7 +682,8 @@ void GfxPicture::drawVectorData(byte *data, int dataSize) {
 				Common::Point startPoint(oldx, oldy);
 				Common::Point endPoint(x, y);
 				_ports->offsetLine(startPoint, endPoint);
-				_screen->drawLine(startPoint, endPoint, pic_color, pic_priority, pic_control);
+				if (!_stateOnly)
+					_screen->drawLine(startPoint, endPoint, pic_color, pic_priority, pic_control);
 			}
 			break;
 		case PIC_OP_LONG_LINES: // long line
@@ -667,14 +694,16 @@ void GfxPicture::drawVectorData(byte *data, int dataSize) {
 				Common::Point startPoint(oldx, oldy);
 				Common::Point endPoint(x, y);
 				_ports->offsetLine(startPoint, endPoint);
-				_screen->drawLine(startPoint, endPoint, pic_color, pic_priority, pic_control);
+				if (!_stateOnly)
+					_screen->drawLine(startPoint, endPoint, pic_color, pic_priority, pic_control);
 			}
 			break;
 
 		case PIC_OP_FILL: //fill
 			while (vectorIsNonOpcode(data[curPos])) {
 				vectorGetAbsCoords(data, curPos, x, y);
-				vectorFloodFill(x, y, pic_color, pic_priority, pic_control);
+				if (!_stateOnly)
+					vectorFloodFill(x, y, pic_color, pic_priority, pic_control);
 			}
 			break;
 
@@ -783,7 +812,8 @@ void GfxPicture::drawVectorData(byte *data, int dataSize) {
 					} else {
 						_priority = 0;
 					}
-					drawCelData(data, _resource->size, curPos, curPos + 8, 0, x, y, 0, 0, true);
+					if (!_stateOnly)
+						drawCelData(data, _resource->size, curPos, curPos + 8, 0, x, y, 0, 0, true);
 					curPos += size;
 					break;
 				case PIC_OPX_EGA_SET_PRIORITY_TABLE:
@@ -832,7 +862,8 @@ void GfxPicture::drawVectorData(byte *data, int dataSize) {
 					} else {
 						_priority = pic_priority; // set global priority so the cel gets drawn using current priority as well
 					}
-					drawCelData(data, _resource->size, curPos, curPos + 8, 0, x, y, 0, 0, false);
+					if (!_stateOnly)
+						drawCelData(data, _resource->size, curPos, curPos + 8, 0, x, y, 0, 0, false);
 					curPos += size;
 					break;
 				case PIC_OPX_VGA_PRIORITY_TABLE_EQDIST:
@@ -851,7 +882,7 @@ void GfxPicture::drawVectorData(byte *data, int dataSize) {
 		case PIC_OP_TERMINATE:
 			_priority = pic_priority;
 			// Dithering EGA pictures
-			if (isEGA) {
+			if (isEGA && !_stateOnly) {
 				_screen->dither(_addToFlag);
 				switch (g_sci->getGameId()) {
 				case GID_SQ3:
@@ -1262,6 +1293,9 @@ void GfxPicture::vectorPattern(int16 x, int16 y, byte color, byte priority, byte
 	byte size = code & SCI_PATTERN_CODE_PENSIZE;
 	Common::Rect rect;
 
+	if (_stateOnly)
+		return;
+
 	// We need to adjust the given coordinates, because the ones given us do not define upper left but somewhat middle
 	y -= size; if (y < 0) y = 0;
 	x -= size; if (x < 0) x = 0;
@@ -51,6 +51,19 @@ public:
 	GuiResourceId getResourceId();
 	void draw(int16 animationNr, bool mirroredFlag, bool addToFlag, int16 EGApaletteNo);
 
+	/**
+	 * Returns true for pictures made of vector data (SCI0 - SCI1), as opposed
+	 * to bitmap based SCI1.1 and SCI32 pictures.
+	 */
+	bool isVectorPicture() const;
+
+	/**
+	 * Runs through the vector data of the picture without drawing anything,
+	 * only applying palette and priority band changes. Used when the drawn
+	 * picture itself gets restored from a cache.
+	 */
+	void drawState(bool mirroredFlag, int16 EGApaletteNo);
+
 #ifdef ENABLE_SCI32
 	int16 getSci32celCount();
 	int16 getSci32celY(int16 celNo);
@@ -98,6 +111,9 @@ private:
 
 	// If true, we will show the whole EGA drawing process...
 	bool _EGAdrawingVisualize;
+
+	// If true, vector data is parsed, but nothing gets drawn (see drawState())
+	bool _stateOnly;
 };
 
 } // End of namespace Sci
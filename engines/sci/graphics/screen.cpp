@@ -172,6 +172,8 @@ GfxScreen::GfxScreen(ResourceManager *resMan) : _resMan(resMan) {
 	_priorityScreen = (byte *)calloc(_pixels, 1);
 	_controlScreen = (byte *)calloc(_pixels, 1);
 	_displayScreen = (byte *)calloc(_displayPixels, 1);
+	_lastCopyScreen = NULL;
+	_lastCopyValid = false;
 
 	memset(&_ditheredPicColors, 0, sizeof(_ditheredPicColors));
 
@@ -249,10 +251,69 @@ GfxScreen::~GfxScreen() {
 	free(_priorityScreen);
 	free(_controlScreen);
 	free(_displayScreen);
+	free(_lastCopyScreen);
 }
 
 void GfxScreen::copyToScreen() {
 	g_system->copyRectToScreen(_activeScreen, _displayWidth, 0, 0, _displayWidth, _displayHeight);
+	_lastCopyValid = false;
+}
+
+/**
+ * Copies only those parts of the active screen to the backend that changed
+ * since the last call. Changed lines are grouped into bands, each of which is
+ * sent as one rect spanning from its leftmost to its rightmost changed pixel.
+ * Returns the amount of pixels that got copied.
+ */
+uint GfxScreen::copyChangedToScreen() {
+	if (!_lastCopyScreen)
+		_lastCopyScreen = (byte *)malloc(_displayPixels);
+
+	if (!_lastCopyValid) {
+		copyToScreen();
+		memcpy(_lastCopyScreen, _activeScreen, _displayPixels);
+		_lastCopyValid = true;
+		return _displayPixels;
+	}
+
+	uint copiedPixels = 0;
+	int bandTop = -1;
+	int bandLeft = _displayWidth, bandRight = 0;
+
+	for (int y = 0; y <= _displayHeight; y++) {
+		const byte *cur = _activeScreen + y * _displayWidth;
+		const byte *last = _lastCopyScreen + y * _displayWidth;
+
+		if (y < _displayHeight && memcmp(cur, last, _displayWidth)) {
+			int left = 0, right = _displayWidth;
+			while (cur[left] == last[left])
+				left++;
+			while (cur[right - 1] == last[right - 1])
+				right--;
+
+			if (bandTop < 0)
+				bandTop = y;
+			bandLeft = MIN(bandLeft, left);
+			bandRight = MAX(bandRight, right);
+			continue;
+		}
+
+		// Line is unchanged (or we're past the end), flush the current band
+		if (bandTop >= 0) {
+			const int bandWidth = bandRight - bandLeft;
+			const int offset = bandTop * _displayWidth + bandLeft;
+			g_system->copyRectToScreen(_activeScreen + offset, _displayWidth, bandLeft, bandTop, bandWidth, y - bandTop);
+			for (int line = bandTop; line < y; line++)
+				memcpy(_lastCopyScreen + line * _displayWidth + bandLeft, _activeScreen + line * _displayWidth + bandLeft, bandWidth);
+			copiedPixels += bandWidth * (y - bandTop);
+
+			bandTop = -1;
+			bandLeft = _displayWidth;
+			bandRight = 0;
+		}
+	}
+
+	return copiedPixels;
 }
 
 void GfxScreen::copyFromScreen(byte *buffer) {
@@ -270,6 +331,8 @@ void GfxScreen::kernelSyncWithFramebuffer() {
 }
 
 void GfxScreen::copyRectToScreen(const Common::Rect &rect) {
+	_lastCopyValid = false;
+
 	if (!_upscaledHires)  {
 		g_system->copyRectToScreen(_activeScreen + rect.top * _displayWidth + rect.left, _displayWidth, rect.left, rect.top, rect.width(), rect.height());
 	} else {
@@ -286,10 +349,13 @@ void GfxScreen::copyRectToScreen(const Common::Rect &rect) {
 void GfxScreen::copyDisplayRectToScreen(const Common::Rect &rect) {
 	if (!_upscaledHires)
 		error("copyDisplayRectToScreen: not in upscaled hires mode");
+	_lastCopyValid = false;
 	g_system->copyRectToScreen(_activeScreen + rect.top * _displayWidth + rect.left, _displayWidth, rect.left, rect.top, rect.width(), rect.height());
 }
 
 void GfxScreen::copyRectToScreen(const Common::Rect &rect, int16 x, int16 y) {
+	_lastCopyValid = false;
+
 	if (!_upscaledHires)  {
 		g_system->copyRectToScreen(_activeScreen + rect.top * _displayWidth + rect.left, _displayWidth, x, y, rect.width(), rect.height());
 	} else {
@@ -435,6 +501,30 @@ void GfxScreen::putPixelAllUpscaled(int16 x, int16 y, byte drawMask, byte color,
 		putScaledPixelOnScreen(_controlScreen, x, y, control);
 }
 
+/**
+ * Draws one line of a view cel. Pixels matching clearKey and pixels behind
+ * something with a higher priority are skipped, all others get mapped to
+ * their palette color. If scalingX is set, pixel x is taken from
+ * bitmap[scalingX[x]]. Only usable while the display is not upscaled.
+ */
+void GfxScreen::putViewLine(int16 x, int16 y, int16 width, const byte *bitmap, const uint16 *scalingX, const byte *mapping, byte clearKey, byte priority, byte drawMask) {
+	assert(_upscaledHires == GFX_SCREEN_UPSCALED_DISABLED);
+	const int offset = y * _width + x;
+	byte *visual = _visualScreen + offset;
+	byte *display = _displayScreen + offset;
+	byte *prio = _priorityScreen + offset;
+	const bool setPriority = (drawMask & GFX_SCREEN_MASK_PRIORITY) != 0;
+
+	for (int16 i = 0; i < width; i++) {
+		const byte color = scalingX ? bitmap[scalingX[i]] : bitmap[i];
+		if (color == clearKey || priority < prio[i])
+			continue;
+		visual[i] = display[i] = mapping[color];
+		if (setPriority)
+			prio[i] = priority;
+	}
+}
+
 /**
  * This is used to put font pixels onto the screen - we adjust differently, so that we won't
  *  do triple pixel lines in any case on upscaled hires. That way the font will not get distorted
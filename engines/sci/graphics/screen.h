@@ -77,6 +77,8 @@ public:
 	byte getColorDefaultVectorData() { return _colorDefaultVectorData; }
 
 	void copyToScreen();
+	uint copyChangedToScreen();
+	void invalidateLastCopy() { _lastCopyValid = false; }
 	void copyFromScreen(byte *buffer);
 	void kernelSyncWithFramebuffer();
 	void copyRectToScreen(const Common::Rect &rect);
@@ -128,6 +130,7 @@ public:
 	//void putPixel(int16 x, int16 y, byte drawMask, byte color, byte prio, byte control);
 	void putFontPixel(int16 startingY, int16 x, int16 y, byte color);
 	void putPixelOnDisplay(int16 x, int16 y, byte color);
+	void putViewLine(int16 x, int16 y, int16 width, const byte *bitmap, const uint16 *scalingX, const byte *mapping, byte clearKey, byte priority, byte drawMask);
 	void drawLine(Common::Point startPoint, Common::Point endPoint, byte color, byte prio, byte control);
 	void drawLine(int16 left, int16 top, int16 right, int16 bottom, byte color, byte prio, byte control) {
 		drawLine(Common::Point(left, top), Common::Point(right, bottom), color, prio, control);
@@ -211,6 +214,15 @@ private:
 	 */
 	byte *_displayScreen;
 
+	/**
+	 * Copy of what copyChangedToScreen() last sent to the backend, so that it
+	 * only needs to send what changed since then. It is invalidated by the
+	 * other methods copying to the backend screen, and has to be invalidated
+	 * by code drawing onto the backend screen directly, like video players.
+	 */
+	byte *_lastCopyScreen;
+	bool _lastCopyValid;
+
 	ResourceManager *_resMan;
 
 	/**
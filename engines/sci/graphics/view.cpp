@@ -23,6 +23,7 @@
 #include "sci/sci.h"
 #include "sci/util.h"
 #include "sci/engine/state.h"
+#include "sci/graphics/cache.h"
 #include "sci/graphics/screen.h"
 #include "sci/graphics/palette.h"
 #include "sci/graphics/coordadjuster.h"
@@ -30,19 +31,29 @@
 
 namespace Sci {
 
-GfxView::GfxView(ResourceManager *resMan, GfxScreen *screen, GfxPalette *palette, GuiResourceId resourceId)
-	: _resMan(resMan), _screen(screen), _palette(palette), _resourceId(resourceId) {
+GfxView::GfxView(ResourceManager *resMan, GfxScreen *screen, GfxPalette *palette, GuiResourceId resourceId, GfxCache *cache)
+	: _resMan(resMan), _cache(cache), _screen(screen), _palette(palette), _resourceId(resourceId) {
 	assert(resourceId != -1);
 	_coordAdjuster = g_sci->_gfxCoordAdjuster;
+	_scalingCelWidth = _scalingCelHeight = -1;
+	_scalingScaleX = _scalingScaleY = -1;
 	initData(resourceId);
 }
 
 GfxView::~GfxView() {
+	const bool useCelCache = canUseCelCache();
+
 	// Iterate through the loops
 	for (uint16 loopNum = 0; loopNum < _loopCount; loopNum++) {
 		// and through the cells of each loop
 		for (uint16 celNum = 0; celNum < _loop[loopNum].celCount; celNum++) {
-			delete[] _loop[loopNum].cel[celNum].rawBitmap;
+			CelInfo *cel = &_loop[loopNum].cel[celNum];
+			// Unpacked cels are handed over to the cache, so that they don't
+			// need to get unpacked again when this view is used next time
+			if (useCelCache && cel->rawBitmap)
+				_cache->storeCelBitmap(_resourceId, loopNum, celNum, cel->rawBitmap, cel->width * cel->height);
+			else
+				delete[] cel->rawBitmap;
 		}
 		delete[] _loop[loopNum].cel;
 	}
@@ -700,8 +711,16 @@ const byte *GfxView::getBitmap(int16 loopNo, int16 celNo) {
 
 	uint16 width = _loop[loopNo].cel[celNo].width;
 	uint16 height = _loop[loopNo].cel[celNo].height;
-	// allocating memory to store cel's bitmap
 	int pixelCount = width * height;
+
+	// the cel may have been unpacked by an earlier instance of this view
+	if (canUseCelCache()) {
+		_loop[loopNo].cel[celNo].rawBitmap = _cache->takeCelBitmap(_resourceId, loopNo, celNo, pixelCount);
+		if (_loop[loopNo].cel[celNo].rawBitmap)
+			return _loop[loopNo].cel[celNo].rawBitmap;
+	}
+
+	// allocating memory to store cel's bitmap
 	_loop[loopNo].cel[celNo].rawBitmap = new byte[pixelCount];
 	byte *pBitmap = _loop[loopNo].cel[celNo].rawBitmap;
 
@@ -720,6 +739,30 @@ const byte *GfxView::getBitmap(int16 loopNo, int16 celNo) {
 	return _loop[loopNo].cel[celNo].rawBitmap;
 }
 
+/**
+ * Unpacked cels only depend on the view resource, except for EGA views, which
+ * get undithered against the picture that is shown at the time of unpacking.
+ */
+bool GfxView::canUseCelCache() const {
+	return _cache && _resMan->getViewType() != kViewEga;
+}
+
+/**
+ * Cel lines can be drawn directly into the screen buffers, as long as the
+ * screen isn't upscaled and none of the colors need remapping against what is
+ * already on screen.
+ */
+bool GfxView::canDrawLines(const Palette *palette) const {
+	if (_screen->getUpscaledHires() != GFX_SCREEN_UPSCALED_DISABLED)
+		return false;
+
+	for (int color = 0; color < 256; color++) {
+		if (_palette->isRemapped(palette->mapping[color]))
+			return false;
+	}
+	return true;
+}
+
 /**
  * Called after unpacking an EGA cel, this will try to undither (parts) of the
  * cel if the dithering in here matches dithering used by the current picture.
@@ -846,7 +889,10 @@ void GfxView::draw(const Common::Rect &rect, const Common::Rect &clipRect, const
 	if (g_sci->getGameId() == GID_ECOQUEST && g_sci->getEngineState()->currentRoomNumber() == 440 && priority == 15)
 		priority = 14;
 
-	if (!_EGAmapping) {
+	if (!_EGAmapping && !upscaledHires && canDrawLines(palette)) {
+		for (y = 0; y < height; y++, bitmap += celWidth)
+			_screen->putViewLine(clipRectTranslated.left, clipRectTranslated.top + y, width, bitmap, NULL, palette->mapping, clearKey, priority, drawMask);
+	} else if (!_EGAmapping) {
 		for (y = 0; y < height; y++, bitmap += celWidth) {
 			for (x = 0; x < width; x++) {
 				const byte color = bitmap[x];
@@ -888,69 +934,80 @@ void GfxView::draw(const Common::Rect &rect, const Common::Rect &clipRect, const
 	}
 }
 
-/**
- * We don't fully follow sierra sci here, I did the scaling algo myself and it
- * is definitely not pixel-perfect with the one sierra is using. It shouldn't
- * matter because the scaled cel rect is definitely the same as in sierra sci.
- */
-void GfxView::drawScaled(const Common::Rect &rect, const Common::Rect &clipRect, const Common::Rect &clipRectTranslated,
-			int16 loopNo, int16 celNo, byte priority, int16 scaleX, int16 scaleY) {
-	const Palette *palette = _embeddedPal ? &_viewPalette : &_palette->_sysPalette;
-	const CelInfo *celInfo = getCelInfo(loopNo, celNo);
-	const byte *bitmap = getBitmap(loopNo, celNo);
-	const int16 celHeight = celInfo->height;
-	const int16 celWidth = celInfo->width;
-	const byte clearKey = celInfo->clearKey;
-	const byte drawMask = priority > 15 ? GFX_SCREEN_MASK_VISUAL : GFX_SCREEN_MASK_VISUAL|GFX_SCREEN_MASK_PRIORITY;
-	uint16 scalingX[640];
-	uint16 scalingY[480];
-	int16 scaledWidth, scaledHeight;
+void GfxView::createScalingTables(int16 celWidth, int16 celHeight, int16 scaleX, int16 scaleY) {
+	int16 scaledWidth = CLIP<int16>((celWidth * scaleX) >> 7, 0, _screen->getWidth());
+	int16 scaledHeight = CLIP<int16>((celHeight * scaleY) >> 7, 0, _screen->getHeight());
 	int pixelNo, scaledPixel, scaledPixelNo, prevScaledPixelNo;
 
-	if (_embeddedPal)
-		// Merge view palette in...
-		_palette->set(&_viewPalette, false);
-
-	scaledWidth = (celInfo->width * scaleX) >> 7;
-	scaledHeight = (celInfo->height * scaleY) >> 7;
-	scaledWidth = CLIP<int16>(scaledWidth, 0, _screen->getWidth());
-	scaledHeight = CLIP<int16>(scaledHeight, 0, _screen->getHeight());
-
-	// Do we really need to do this?!
-	//memset(scalingX, 0, sizeof(scalingX));
-	//memset(scalingY, 0, sizeof(scalingY));
-
 	// Create height scaling table
 	pixelNo = 0;
 	scaledPixel = scaledPixelNo = prevScaledPixelNo = 0;
 	while (pixelNo < celHeight) {
 		scaledPixelNo = scaledPixel >> 7;
-		assert(scaledPixelNo < ARRAYSIZE(scalingY));
+		assert(scaledPixelNo < ARRAYSIZE(_scalingY));
 		for (; prevScaledPixelNo <= scaledPixelNo; prevScaledPixelNo++)
-			scalingY[prevScaledPixelNo] = pixelNo;
+			_scalingY[prevScaledPixelNo] = pixelNo;
 		pixelNo++;
 		scaledPixel += scaleY;
 	}
 	pixelNo--;
 	scaledPixelNo++;
 	for (; scaledPixelNo < scaledHeight; scaledPixelNo++)
-		scalingY[scaledPixelNo] = pixelNo;
+		_scalingY[scaledPixelNo] = pixelNo;
 
 	// Create width scaling table
 	pixelNo = 0;
 	scaledPixel = scaledPixelNo = prevScaledPixelNo = 0;
 	while (pixelNo < celWidth) {
 		scaledPixelNo = scaledPixel >> 7;
-		assert(scaledPixelNo < ARRAYSIZE(scalingX));
+		assert(scaledPixelNo < ARRAYSIZE(_scalingX));
 		for (; prevScaledPixelNo <= scaledPixelNo; prevScaledPixelNo++)
-			scalingX[prevScaledPixelNo] = pixelNo;
+			_scalingX[prevScaledPixelNo] = pixelNo;
 		pixelNo++;
 		scaledPixel += scaleX;
 	}
 	pixelNo--;
 	scaledPixelNo++;
 	for (; scaledPixelNo < scaledWidth; scaledPixelNo++)
-		scalingX[scaledPixelNo] = pixelNo;
+		_scalingX[scaledPixelNo] = pixelNo;
+
+	_scalingCelWidth = celWidth;
+	_scalingCelHeight = celHeight;
+	_scalingScaleX = scaleX;
+	_scalingScaleY = scaleY;
+}
+
+/**
+ * We don't fully follow sierra sci here, I did the scaling algo myself and it
+ * is definitely not pixel-perfect with the one sierra is using. It shouldn't
+ * matter because the scaled cel rect is definitely the same as in sierra sci.
+ */
+void GfxView::drawScaled(const Common::Rect &rect, const Common::Rect &clipRect, const Common::Rect &clipRectTranslated,
+			int16 loopNo, int16 celNo, byte priority, int16 scaleX, int16 scaleY) {
+	const Palette *palette = _embeddedPal ? &_viewPalette : &_palette->_sysPalette;
+	const CelInfo *celInfo = getCelInfo(loopNo, celNo);
+	const byte *bitmap = getBitmap(loopNo, celNo);
+	const int16 celHeight = celInfo->height;
+	const int16 celWidth = celInfo->width;
+	const byte clearKey = celInfo->clearKey;
+	const byte drawMask = priority > 15 ? GFX_SCREEN_MASK_VISUAL : GFX_SCREEN_MASK_VISUAL|GFX_SCREEN_MASK_PRIORITY;
+	int16 scaledWidth, scaledHeight;
+
+	if (_embeddedPal)
+		// Merge view palette in...
+		_palette->set(&_viewPalette, false);
+
+	scaledWidth = (celInfo->width * scaleX) >> 7;
+	scaledHeight = (celInfo->height * scaleY) >> 7;
+	scaledWidth = CLIP<int16>(scaledWidth, 0, _screen->getWidth());
+	scaledHeight = CLIP<int16>(scaledHeight, 0, _screen->getHeight());
+
+	// Actors are usually drawn at the same scale frame after frame
+	if (celWidth != _scalingCelWidth || celHeight != _scalingCelHeight || scaleX != _scalingScaleX || scaleY != _scalingScaleY)
+		createScalingTables(celWidth, celHeight, scaleX, scaleY);
+
+	const uint16 *scalingX = _scalingX;
+	const uint16 *scalingY = _scalingY;
 
 	scaledWidth = MIN(clipRect.width(), scaledWidth);
 	scaledHeight = MIN(clipRect.height(), scaledHeight);
@@ -962,8 +1019,15 @@ void GfxView::drawScaled(const Common::Rect &rect, const Common::Rect &clipRect,
 	if (offsetX < 0 || offsetY < 0)
 		return;
 
-	assert(scaledHeight + offsetY <= ARRAYSIZE(scalingY));
-	assert(scaledWidth + offsetX <= ARRAYSIZE(scalingX));
+	assert(scaledHeight + offsetY <= ARRAYSIZE(_scalingY));
+	assert(scaledWidth + offsetX <= ARRAYSIZE(_scalingX));
+
+	if (canDrawLines(palette)) {
+		for (int y = 0; y < scaledHeight; y++)
+			_screen->putViewLine(clipRectTranslated.left, clipRectTranslated.top + y, scaledWidth, bitmap + scalingY[y + offsetY] * celWidth, scalingX + offsetX, palette->mapping, clearKey, priority, drawMask);
+		return;
+	}
+
 	for (int y = 0; y < scaledHeight; y++) {
 		for (int x = 0; x < scaledWidth; x++) {
 			const byte color = bitmap[scalingY[y + offsetY] * celWidth + scalingX[x + offsetX]];
@@ -55,6 +55,7 @@ struct LoopInfo {
 
 class GfxScreen;
 class GfxPalette;
+class GfxCache;
 
 /**
  * View class, handles loading of view resources and drawing contained cels to screen
@@ -62,7 +63,7 @@ class GfxPalette;
  */
 class GfxView {
 public:
-	GfxView(ResourceManager *resMan, GfxScreen *screen, GfxPalette *palette, GuiResourceId resourceId);
+	GfxView(ResourceManager *resMan, GfxScreen *screen, GfxPalette *palette, GuiResourceId resourceId, GfxCache *cache = NULL);
 	~GfxView();
 
 	GuiResourceId getResourceId() const;
@@ -91,8 +92,12 @@ private:
 	void initData(GuiResourceId resourceId);
 	void unpackCel(int16 loopNo, int16 celNo, byte *outPtr, uint32 pixelCount);
 	void unditherBitmap(byte *bitmap, int16 width, int16 height, byte clearKey);
+	bool canUseCelCache() const;
+	bool canDrawLines(const Palette *palette) const;
+	void createScalingTables(int16 celWidth, int16 celHeight, int16 scaleX, int16 scaleY);
 
 	ResourceManager *_resMan;
+	GfxCache *_cache;
 	GfxCoordAdjuster *_coordAdjuster;
 	GfxScreen *_screen;
 	GfxPalette *_palette;
@@ -118,6 +123,13 @@ private:
 	// this is not set for some views in laura bow 2 floppy and signals that the view shall never get scaled
 	//  even if scaleX/Y are set (inside kAnimate)
 	bool _isScaleable;
+
+	// scaling tables of the last scaled draw, reused as long as cel size and
+	// scale stay the same
+	uint16 _scalingX[640];
+	uint16 _scalingY[480];
+	int16 _scalingCelWidth, _scalingCelHeight;
+	int16 _scalingScaleX, _scalingScaleY;
 };
 
 } // End of namespace Sci
@@ -22,9 +22,11 @@
 
 // Resource library
 
+#include "common/config-manager.h"
 #include "common/file.h"
 #include "common/fs.h"
 #include "common/macresman.h"
+#include "common/system.h"
 #include "common/textconsole.h"
 
 #include "sci/resource.h"
@@ -194,6 +196,7 @@ Resource::Resource(ResourceManager *resMan, ResourceId id) : _resMan(resMan), _i
 	_source = NULL;
 	_header = NULL;
 	_headerSize = 0;
+	_reloadCost = 0;
 }
 
 Resource::~Resource() {
@@ -370,7 +373,34 @@ Common::SeekableReadStream *ResourceManager::getVolumeFile(ResourceSource *sourc
 }
 
 void ResourceManager::loadResource(Resource *res) {
+	// Decompressing sets a cost based on the compression method, anything
+	// else is just read
+	res->_reloadCost = 0;
+
+	// The time of a single load is too short to be measured in ms, but
+	// the sum over many loads is still a useful figure
+	const uint32 startTime = g_system->getMillis();
 	res->_source->loadResource(this, res);
+	const uint32 loadTime = g_system->getMillis() - startTime;
+
+	if (!res->_reloadCost)
+		res->_reloadCost = Resource::getReloadCost(kCompNone, res->size, res->size);
+
+	_lruStats.loads++;
+	_lruStats.loadTime += loadTime;
+
+	// Keep track of the throughput, to know how much can be prefetched in
+	// the time left until the next frame
+	if (res->_status == kResStatusAllocated) {
+		_loadedBytes += res->size;
+		_loadedTime += loadTime;
+
+		// Let recent loads weigh more, and avoid overflows
+		if (_loadedBytes >= 0x40000000) {
+			_loadedBytes /= 2;
+			_loadedTime /= 2;
+		}
+	}
 }
 
 
@@ -863,7 +893,12 @@ ResourceManager::ResourceManager() {
 void ResourceManager::init() {
 	_memoryLocked = 0;
 	_memoryLRU = 0;
+	_maxMemoryLRU = MAX_MEMORY;
+	resetLRUStats();
 	_LRU.clear();
+	_prefetchQueue.clear();
+	_loadedBytes = 0;
+	_loadedTime = 0;
 	_resMap.clear();
 	_audioMapSCI1 = NULL;
 
@@ -914,6 +949,8 @@ void ResourceManager::init() {
 
 	debugC(1, kDebugLevelResMan, "resMan: Detected %s", getSciVersionDesc(getSciVersion()));
 
+	initMaxMemoryLRU();
+
 	switch (_viewType) {
 	case kViewEga:
 		debugC(1, kDebugLevelResMan, "resMan: Detected EGA graphic resources");
@@ -949,7 +986,12 @@ void ResourceManager::initForDetection() {
 
 	_memoryLocked = 0;
 	_memoryLRU = 0;
+	_maxMemoryLRU = MAX_MEMORY;
+	resetLRUStats();
 	_LRU.clear();
+	_prefetchQueue.clear();
+	_loadedBytes = 0;
+	_loadedTime = 0;
 	_resMap.clear();
 	_audioMapSCI1 = NULL;
 
@@ -1018,12 +1060,54 @@ void ResourceManager::printLRU() {
 	debug("Total: %d entries, %d bytes (mgr says %d)", entries, mem, _memoryLRU);
 }
 
+void ResourceManager::initMaxMemoryLRU() {
+	// The original limit was tuned for machines with a few MB of RAM. Later
+	// games have far bigger views, pictures and audio maps, so scale the
+	// budget up with the engine generation to avoid decompressing the same
+	// resources over and over.
+	if (getSciVersion() >= SCI_VERSION_2)
+		_maxMemoryLRU = 32 * MAX_MEMORY;	// 8MB
+	else if (getSciVersion() >= SCI_VERSION_1_1)
+		_maxMemoryLRU = 8 * MAX_MEMORY;		// 2MB
+	else if (getSciVersion() >= SCI_VERSION_1_EGA_ONLY)
+		_maxMemoryLRU = 4 * MAX_MEMORY;		// 1MB
+	else
+		_maxMemoryLRU = MAX_MEMORY;
+
+	if (ConfMan.hasKey("sci_resource_cache_kb")) {
+		int cacheKB = ConfMan.getInt("sci_resource_cache_kb");
+		if (cacheKB > 0)
+			_maxMemoryLRU = cacheKB * 1024;
+	}
+
+	debugC(1, kDebugLevelResMan, "resMan: Resource cache budget is %d KB", _maxMemoryLRU / 1024);
+}
+
+void ResourceManager::resetLRUStats() {
+	_lruStats.hits = 0;
+	_lruStats.loads = 0;
+	_lruStats.loadTime = 0;
+	_lruStats.evictions = 0;
+}
+
 void ResourceManager::freeOldResources() {
-	while (MAX_MEMORY < _memoryLRU) {
+	while (_maxMemoryLRU < (uint32)_memoryLRU) {
 		assert(!_LRU.empty());
-		Resource *goner = *_LRU.reverse_begin();
+
+		// Among the least recently used resources, pick the one that is
+		// cheapest to reload for the memory it frees, i.e. with the lowest
+		// cost per byte. On ties, the oldest one goes first.
+		Common::List<Resource *>::iterator it = _LRU.reverse_begin();
+		Resource *goner = *it;
+		for (int i = 1; i < LRU_EVICTION_WINDOW && it != _LRU.begin(); i++) {
+			--it;
+			if ((uint64)(*it)->_reloadCost * goner->size < (uint64)goner->_reloadCost * (*it)->size)
+				goner = *it;
+		}
+
 		removeFromLRU(goner);
 		goner->unalloc();
+		_lruStats.evictions++;
 #ifdef SCI_VERBOSE_RESMAN
 		debug("resMan-debug: LRU: Freeing %s.%03d (%d bytes)", getResourceTypeName(goner->type), goner->number, goner->size);
 #endif
@@ -1049,10 +1133,13 @@ Resource *ResourceManager::findResource(ResourceId id, bool lock) {
 	if (!retval)
 		return NULL;
 
-	if (retval->_status == kResStatusNoMalloc)
+	if (retval->_status == kResStatusNoMalloc) {
 		loadResource(retval);
-	else if (retval->_status == kResStatusEnqueued)
-		removeFromLRU(retval);
+	} else {
+		_lruStats.hits++;
+		if (retval->_status == kResStatusEnqueued)
+			removeFromLRU(retval);
+	}
 	// Unless an error occurred, the resource is now either
 	// locked or allocated, but never queued or freed.
 
@@ -1078,6 +1165,67 @@ Resource *ResourceManager::findResource(ResourceId id, bool lock) {
 	}
 }
 
+void ResourceManager::prefetchResource(ResourceId id) {
+	Resource *res = testResource(id);
+
+	// Only queue resources which are not in memory yet
+	if (!res || res->_status != kResStatusNoMalloc)
+		return;
+
+	if (_prefetchQueue.size() >= MAX_PREFETCH_QUEUE)
+		return;
+
+	_prefetchQueue.push_back(id);
+}
+
+uint32 ResourceManager::estimatePrefetchTime(const Resource *res) const {
+	// Until enough has been loaded to measure the throughput, assume a slow
+	// machine
+	uint32 bytesPerMs = PREFETCH_DEFAULT_THROUGHPUT;
+	if (_loadedBytes >= 4 * PREFETCH_UNKNOWN_SIZE)
+		bytesPerMs = MAX<uint32>(_loadedBytes / MAX<uint32>(_loadedTime, 1), 1);
+
+	// The size of volume resources is only known once they have been
+	// loaded, so assume they are big
+	const uint32 size = res->size ? res->size : (uint32)PREFETCH_UNKNOWN_SIZE;
+
+	return (size + bytesPerMs - 1) / bytesPerMs;
+}
+
+bool ResourceManager::prefetchNext(uint32 timeBudget) {
+	Common::List<ResourceId>::iterator it = _prefetchQueue.begin();
+	while (it != _prefetchQueue.end()) {
+		Resource *res = testResource(*it);
+
+		// The resource may have been loaded in the meantime
+		if (!res || res->_status != kResStatusNoMalloc) {
+			it = _prefetchQueue.erase(it);
+			continue;
+		}
+
+		// Leave resources which take too long for later, or for when they
+		// are actually needed
+		if (estimatePrefetchTime(res) > timeBudget) {
+			++it;
+			continue;
+		}
+
+		_prefetchQueue.erase(it);
+
+		debugC(2, kDebugLevelResMan, "[resMan] Prefetching %s", res->_id.toString().c_str());
+
+		loadResource(res);
+		if (res->_status == kResStatusAllocated) {
+			addToLRU(res);
+			freeOldResources();
+		}
+
+		return true;
+	}
+
+	return false;
+}
+
 void ResourceManager::unlockResource(Resource *res) {
 	assert(res);
 
@@ -1956,6 +2104,32 @@ int Resource::readResourceInfo(ResVersion volVersion, Common::SeekableReadStream
 	return (compression == kCompUnknown) ? SCI_ERROR_UNKNOWN_COMPRESSION : SCI_ERROR_NONE;
 }
 
+uint32 Resource::getReloadCost(ResourceCompression compression, uint32 packedSize, uint32 unpackedSize) {
+	// The cost is given in bytes processed: every packed byte has to be read,
+	// and every unpacked byte produced by a decompressor. The factors reflect
+	// how much work the decompressors do per byte, e.g. Huffman walks its
+	// tree bit by bit, and views and pics compressed with LZW1 are
+	// reordered after unpacking.
+	uint32 factor;
+	switch (compression) {
+	case kCompNone:
+		factor = 0;
+		break;
+	case kCompHuffman:
+		factor = 4;
+		break;
+	case kCompLZW1View:
+	case kCompLZW1Pic:
+		factor = 3;
+		break;
+	default:
+		factor = 2;
+		break;
+	}
+
+	return packedSize + factor * unpackedSize;
+}
+
 int Resource::decompress(ResVersion volVersion, Common::SeekableReadStream *file) {
 	int errorNum;
 	uint32 szPacked = 0;
@@ -1996,6 +2170,7 @@ int Resource::decompress(ResVersion volVersion, Common::SeekableReadStream *file
 
 	data = new byte[size];
 	_status = kResStatusAllocated;
+	_reloadCost = getReloadCost(compression, szPacked, size);
 	errorNum = data ? dec->unpack(file, data, szPacked, size) : SCI_ERROR_RESOURCE_TOO_BIG;
 	if (errorNum)
 		unalloc();
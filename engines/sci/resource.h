@@ -68,7 +68,10 @@ enum ResourceErrorCodes {
 };
 
 enum {
-	MAX_OPENED_VOLUMES = 5 ///< Max number of simultaneously opened volumes
+	MAX_OPENED_VOLUMES = 5, ///< Max number of simultaneously opened volumes
+	MAX_PREFETCH_QUEUE = 64, ///< Max number of resources waiting to be prefetched
+	PREFETCH_DEFAULT_THROUGHPUT = 512, ///< Assumed bytes per ms for loading until measured
+	PREFETCH_UNKNOWN_SIZE = 16 * 1024 ///< Assumed size of resources whose size isn't known yet
 };
 
 enum ResourceType {
@@ -260,6 +263,7 @@ public:
 	void writeToStream(Common::WriteStream *stream) const;
 
 	const Common::String &getResourceLocation() const;
+	int32 getFileOffset() const { return _fileOffset; }
 
 	// FIXME: This audio specific method is a hack. After all, why should a
 	// Resource have audio specific methods? But for now we keep this, as it
@@ -273,6 +277,7 @@ protected:
 	uint16 _lockers; /**< Number of places where this resource was locked */
 	ResourceSource *_source;
 	ResourceManager *_resMan;
+	uint32 _reloadCost; /**< Estimated cost of loading this resource again, see getReloadCost() */
 
 	bool loadPatch(Common::SeekableReadStream *file);
 	bool loadFromPatchFile();
@@ -280,6 +285,7 @@ protected:
 	bool loadFromAudioVolumeSCI1(Common::SeekableReadStream *file);
 	bool loadFromAudioVolumeSCI11(Common::SeekableReadStream *file);
 	int decompress(ResVersion volVersion, Common::SeekableReadStream *file);
+	static uint32 getReloadCost(ResourceCompression compression, uint32 packedSize, uint32 unpackedSize);
 	int readResourceInfo(ResVersion volVersion, Common::SeekableReadStream *file, uint32 &szPacked, ResourceCompression &compression);
 };
 
@@ -421,22 +427,66 @@ public:
 	 */
 	ResourceType convertResType(byte type);
 
+	/**
+	 * Resource cache statistics, shown by the "resource_stats" console command.
+	 */
+	struct LRUStats {
+		uint32 hits;		///< Requests served from memory
+		uint32 loads;		///< Requests which had to read the resource from disk
+		uint32 loadTime;	///< Total time in ms spent reading and decompressing
+		uint32 evictions;	///< Resources freed to stay within the budget
+	};
+
+	/**
+	 * Queues a resource to be loaded ahead of time, e.g. when a script
+	 * announces that it is going to need it. Queued resources are loaded by
+	 * prefetchNext() whenever the engine is idle, and are put under LRU
+	 * control afterwards.
+	 */
+	void prefetchResource(ResourceId id);
+
+	/**
+	 * Loads the first resource from the prefetch queue which is expected to
+	 * load within the given time, based on the throughput of the previous
+	 * prefetches.
+	 * @param timeBudget	time in ms which may be spent
+	 * @return false if no queued resource fits into the budget
+	 */
+	bool prefetchNext(uint32 timeBudget);
+
+	const LRUStats &getLRUStats() const { return _lruStats; }
+	int getMemoryLRU() const { return _memoryLRU; }
+	int getMemoryLocked() const { return _memoryLocked; }
+	uint32 getMaxMemoryLRU() const { return _maxMemoryLRU; }
+	void resetLRUStats();
+
 protected:
-	// Maximum number of bytes to allow being allocated for resources
+	// Default number of bytes to allow being allocated for resources. The
+	// actual budget is scaled up for later SCI versions, and may be overridden
+	// with the "sci_resource_cache_kb" config key.
 	// Note: maxMemory will not be interpreted as a hard limit, only as a restriction
 	// for resources which are not explicitly locked. However, a warning will be
 	// issued whenever this limit is exceeded.
 	enum {
-		MAX_MEMORY = 256 * 1024	// 256KB
+		MAX_MEMORY = 256 * 1024,	// 256KB
+		// Number of least recently used resources considered for eviction.
+		// Among these, the one that is cheapest to reload per byte freed
+		// goes first.
+		LRU_EVICTION_WINDOW = 8
 	};
 
 	ViewType _viewType; // Used to determine if the game has EGA or VGA graphics
 	Common::List<ResourceSource *> _sources;
 	int _memoryLocked;	///< Amount of resource bytes in locked memory
 	int _memoryLRU;		///< Amount of resource bytes under LRU control
+	uint32 _maxMemoryLRU;	///< Budget for resources under LRU control
+	LRUStats _lruStats;
 	Common::List<Resource *> _LRU; ///< Last Resource Used list
 	ResourceMap _resMap;
 	Common::List<Common::File *> _volumeFiles; ///< list of opened volume files
+	Common::List<ResourceId> _prefetchQueue; ///< Resources to load when the engine is idle
+	uint32 _loadedBytes; ///< Total size of the resources loaded so far
+	uint32 _loadedTime; ///< Total time in ms spent loading them
 	ResourceSource *_audioMapSCI1; ///< Currently loaded audio map for SCI1
 	ResVersion _volVersion; ///< resource.0xx version
 	ResVersion _mapVersion; ///< resource.map version
@@ -489,6 +539,15 @@ protected:
 	Common::SeekableReadStream *getVolumeFile(ResourceSource *source);
 	void loadResource(Resource *res);
 	void freeOldResources();
+
+	/** Estimates the time in ms it takes to load the given resource. */
+	uint32 estimatePrefetchTime(const Resource *res) const;
+
+	/**
+	 * Determines the memory budget for resources under LRU control, based on
+	 * the detected SCI version and the "sci_resource_cache_kb" config key.
+	 */
+	void initMaxMemoryLRU();
 	void addResource(ResourceId resId, ResourceSource *src, uint32 offset, uint32 size = 0);
 	Resource *updateResource(ResourceId resId, ResourceSource *src, uint32 size);
 	void removeAudioResource(ResourceId resId);
@@ -40,7 +40,7 @@ public:
 		kVoices = 4
 	};
 
-	MidiDriver_AmigaMac(Audio::Mixer *mixer) : MidiDriver_Emulated(mixer), _playSwitch(true), _masterVolume(15) { }
+	MidiDriver_AmigaMac(Audio::Mixer *mixer) : MidiDriver_Emulated(mixer), _playSwitch(true), _masterVolume(15) { _baseFreq = SCI_MIDI_TICK_RATE; }
 	virtual ~MidiDriver_AmigaMac() { }
 
 	// MidiDriver
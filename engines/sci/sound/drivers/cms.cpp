@@ -39,6 +39,7 @@ class MidiDriver_CMS : public MidiDriver_Emulated {
 public:
 	MidiDriver_CMS(Audio::Mixer *mixer, ResourceManager *resMan)
 	    : MidiDriver_Emulated(mixer), _resMan(resMan), _cms(0), _rate(0), _playSwitch(true), _masterVolume(0) {
+		_baseFreq = SCI_MIDI_TICK_RATE;
 	}
 
 	int open();
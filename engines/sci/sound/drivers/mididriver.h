@@ -52,6 +52,12 @@ enum {
 
 #define MIDI_RHYTHM_CHANNEL 9
 
+// SSCI calls its sound drivers from a 60Hz timer interrupt, and the delta
+// times of SCI MIDI data are in these ticks. The emulated drivers run their
+// timer at this rate too, so that every tick starts at an exact sample
+// position of their output.
+#define SCI_MIDI_TICK_RATE 60
+
 /* Special SCI sound stuff */
 
 #define SCI_MIDI_TIME_EXPANSION_PREFIX 0xF8
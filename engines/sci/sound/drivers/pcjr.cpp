@@ -66,7 +66,7 @@ public:
 		kMaxChannels = 3
 	};
 
-	MidiDriver_PCJr(Audio::Mixer *mixer) : MidiDriver_Emulated(mixer) { }
+	MidiDriver_PCJr(Audio::Mixer *mixer) : MidiDriver_Emulated(mixer) { _baseFreq = SCI_MIDI_TICK_RATE; }
 	~MidiDriver_PCJr() { }
 
 	// MidiDriver
@@ -50,8 +50,10 @@ MidiParser_SCI::MidiParser_SCI(SciVersion soundVersion, SciMusic *music) :
 	_mixedData = NULL;
 	// mididata contains delta in 1/60th second
 	// values of ppqn and tempo are found experimentally and may be wrong
+	// The tempo equals the timer rate of the emulated drivers, so that each
+	// of their timer calls processes exactly one tick.
 	_ppqn = 1;
-	setTempo(16667);
+	setTempo(1000000 / SCI_MIDI_TICK_RATE);
 
 	_masterVolume = 15;
 	_volume = 127;
@@ -21,6 +21,7 @@
  */
 
 #include "common/archive.h"
+#include "common/memstream.h"
 #include "common/stream.h"
 #include "common/substream.h"
 #include "common/system.h"
@@ -75,6 +76,13 @@ RobotDecoder::RobotDecoder(bool isBigEndian) {
 	_pos = Common::Point(0, 0);
 	_isBigEndian = isBigEndian;
 	_frameTotalSize = 0;
+	_frameData = 0;
+	_frameDataSize = 0;
+	_celData = 0;
+	_celDataSize = 0;
+	_nextFrame = 0;
+	_readFrame = -1;
+	_decodedFrame = -1;
 }
 
 RobotDecoder::~RobotDecoder() {
@@ -105,6 +113,9 @@ bool RobotDecoder::loadStream(Common::SeekableReadStream *stream) {
 	videoTrack->readPaletteChunk(_fileStream, _header.paletteDataSize);
 	readFrameSizesChunk();
 	videoTrack->calculateVideoDimensions(_fileStream, _frameTotalSize);
+
+	Graphics::Surface *surface = videoTrack->getSurface();
+	_nextFrame = (byte *)calloc(surface->w * surface->h, 1);
 	return true;
 }
 
@@ -143,6 +154,20 @@ void RobotDecoder::close() {
 
 	delete[] _frameTotalSize;
 	_frameTotalSize = 0;
+
+	delete[] _frameData;
+	_frameData = 0;
+	_frameDataSize = 0;
+
+	delete[] _celData;
+	_celData = 0;
+	_celDataSize = 0;
+
+	// Allocated like the surface pixels, since the two get swapped
+	free(_nextFrame);
+	_nextFrame = 0;
+	_readFrame = -1;
+	_decodedFrame = -1;
 }
 
 void RobotDecoder::readNextPacket() {
@@ -154,14 +179,95 @@ void RobotDecoder::readNextPacket() {
 	if (videoTrack->endOfTrack())
 		return;
 
+	// Show the frame, which usually has been decoded ahead of time already
+	int curFrame = videoTrack->getCurFrame();
+	decodeFrame(curFrame);
+
+	void *pixels = surface->getPixels();
+	surface->setPixels(_nextFrame);
+	_nextFrame = (byte *)pixels;
+	_decodedFrame = -1;
+
+	// Queue the audio of the following frame right away, so that the audio
+	// stream does not run dry while waiting for the next packet
+	if (curFrame + 1 < videoTrack->getFrameCount())
+		readFrame(curFrame + 1);
+}
+
+bool RobotDecoder::decodeAhead() {
+	if (!isVideoLoaded())
+		return false;
+
+	RobotVideoTrack *videoTrack = (RobotVideoTrack *)getTrack(0);
+	int nextFrame = videoTrack->getCurFrame() + 1;
+
+	if (nextFrame >= videoTrack->getFrameCount() || _decodedFrame == nextFrame)
+		return false;
+
+	decodeFrame(nextFrame);
+	return true;
+}
+
+void RobotDecoder::readFrame(int frame) {
+	if (_readFrame == frame)
+		return;
+
+	// Frames are read sequentially from the file
+	assert(frame == _readFrame + 1);
+
+	// Read the whole frame at once, instead of reading the compressed data
+	// and the audio byte by byte from the file
+	uint32 frameSize = _frameTotalSize[frame];
+	assert(frameSize <= _frameDataSize);
+	_fileStream->read(_frameData, frameSize);
+	_readFrame = frame;
+
+	if (!_header.hasSound)
+		return;
+
+	// The audio follows the image data
+	Common::MemoryReadStreamEndian frameStream(_frameData, frameSize, _isBigEndian);
+	frameStream.seek(16);
+	uint16 compressedSize = frameStream.readUint16();
+	frameStream.seek(24 + compressedSize);
+	uint32 audioChunkSize = frameSize - (24 + compressedSize);
+
+// TODO: The audio chunk size below is usually correct, but there are some
+// exceptions (e.g. robot 4902 in Phantasmagoria, towards its end)
+#if 0
+	// Read frame audio header (14 bytes)
+	frameStream.skip(2); // buffer position
+	frameStream.skip(2); // unknown (usually 1)
+	frameStream.skip(2); /*uint16 audioChunkSize = frameStream.readUint16() + 8;*/
+	frameStream.skip(2);
+#endif
+
+	// Queue the audio frame
+	// FIXME: For some reason, there are audio hiccups/gaps
+	RobotAudioTrack *audioTrack = (RobotAudioTrack *)getTrack(1);
+	frameStream.skip(8); // header
+	audioChunkSize -= 8;
+	audioTrack->queueBuffer(g_sci->_audio->getDecodedRobotAudioFrame(&frameStream, audioChunkSize), audioChunkSize * 2);
+}
+
+void RobotDecoder::decodeFrame(int frame) {
+	if (_decodedFrame == frame)
+		return;
+
+	readFrame(frame);
+
+	RobotVideoTrack *videoTrack = (RobotVideoTrack *)getTrack(0);
+	Graphics::Surface *surface = videoTrack->getSurface();
+	Common::MemoryReadStreamEndian frameStream(_frameData, _frameTotalSize[frame], _isBigEndian);
+
 	// Read frame image header (24 bytes)
-	_fileStream->skip(3);
-	byte frameScale = _fileStream->readByte();
-	uint16 frameWidth = _fileStream->readUint16();
-	uint16 frameHeight = _fileStream->readUint16();
-	_fileStream->skip(4); // unknown, almost always 0
-	uint16 frameX = _fileStream->readUint16();
-	uint16 frameY = _fileStream->readUint16();
+	frameStream.skip(3);
+	byte frameScale = frameStream.readByte();
+	uint16 frameWidth = frameStream.readUint16();
+	uint16 frameHeight = frameStream.readUint16();
+	frameStream.skip(4); // unknown, almost always 0
+	uint16 frameX = frameStream.readUint16();
+	uint16 frameY = frameStream.readUint16();
 
 	// TODO: In v4 robot files, frameX and frameY have a different meaning.
 	// Set them both to 0 for v4 for now, so that robots in PQ:SWAT show up
@@ -169,9 +275,9 @@ void RobotDecoder::readNextPacket() {
 	if (_header.version == 4)
 		frameX = frameY = 0;
 
-	uint16 compressedSize = _fileStream->readUint16();
-	uint16 frameFragments = _fileStream->readUint16();
-	_fileStream->skip(4); // unknown
+	uint16 compressedSize = frameStream.readUint16();
+	uint16 frameFragments = frameStream.readUint16();
+	frameStream.skip(4); // unknown
 	uint32 decompressedSize = frameWidth * frameHeight * frameScale / 100;
 
 	// FIXME: A frame's height + position can go off limits... why? With the
@@ -185,25 +291,47 @@ void RobotDecoder::readNextPacket() {
 
 	assert(frameWidth + frameX <= surface->w && scaledHeight + frameY <= surface->h);
 
+	// The frame is decoded into the back buffer, which has the same layout
+	// as the surface, and gets swapped with it once the frame is shown
+	byte *outFrame = _nextFrame;
+
+	// Black out the surface
+	memset(outFrame, 0, surface->w * surface->h);
+
+	// Cels spanning the whole width of the surface, which aren't cut, are
+	// decompressed in place. Everything else goes through the cel buffer.
+	bool inPlace = frameWidth == surface->w && decompressedSize == (uint32)scaledHeight * frameWidth;
+	byte *outPtr;
+
+	if (inPlace) {
+		outPtr = outFrame + surface->w * frameY;
+	} else {
+		if (decompressedSize > _celDataSize) {
+			delete[] _celData;
+			_celDataSize = decompressedSize;
+			_celData = new byte[_celDataSize];
+		}
+		outPtr = _celData;
+	}
+
+	byte *inFrame = outPtr;
 	DecompressorLZS lzs;
-	byte *decompressedFrame = new byte[decompressedSize];
-	byte *outPtr = decompressedFrame;
 
 	if (_header.version == 4) {
 		// v4 has just the one fragment, it seems, and ignores the fragment count
-		Common::SeekableSubReadStream fragmentStream(_fileStream, _fileStream->pos(), _fileStream->pos() + compressedSize);
+		Common::SeekableSubReadStream fragmentStream(&frameStream, frameStream.pos(), frameStream.pos() + compressedSize);
 		lzs.unpack(&fragmentStream, outPtr, compressedSize, decompressedSize);
 	} else {
 		for (uint16 i = 0; i < frameFragments; ++i) {
-			uint32 compressedFragmentSize = _fileStream->readUint32();
-			uint32 decompressedFragmentSize = _fileStream->readUint32();
-			uint16 compressionType = _fileStream->readUint16();
+			uint32 compressedFragmentSize = frameStream.readUint32();
+			uint32 decompressedFragmentSize = frameStream.readUint32();
+			uint16 compressionType = frameStream.readUint16();
 
 			if (compressionType == 0) {
-				Common::SeekableSubReadStream fragmentStream(_fileStream, _fileStream->pos(), _fileStream->pos() + compressedFragmentSize);
+				Common::SeekableSubReadStream fragmentStream(&frameStream, frameStream.pos(), frameStream.pos() + compressedFragmentSize);
 				lzs.unpack(&fragmentStream, outPtr, compressedFragmentSize, decompressedFragmentSize);
 			} else if (compressionType == 2) {	// untested
-				_fileStream->read(outPtr, compressedFragmentSize);
+				frameStream.read(outPtr, compressedFragmentSize);
 			} else {
 				error("Unknown frame compression found: %d", compressionType);
 			}
@@ -213,45 +341,18 @@ void RobotDecoder::readNextPacket() {
 	}
 
 	// Copy over the decompressed frame
-	byte *inFrame = decompressedFrame;
-	byte *outFrame = (byte *)surface->getPixels();
-
-	// Black out the surface
-	memset(outFrame, 0, surface->w * surface->h);
-
-	// Move to the correct y coordinate
-	outFrame += surface->w * frameY;
-
-	for (uint16 y = 0; y < scaledHeight; y++) {
-		memcpy(outFrame + frameX, inFrame, frameWidth);
-		inFrame += frameWidth;
-		outFrame += surface->w;
+	if (!inPlace) {
+		// Move to the correct y coordinate
+		outFrame += surface->w * frameY;
+
+		for (uint16 y = 0; y < scaledHeight; y++) {
+			memcpy(outFrame + frameX, inFrame, frameWidth);
+			inFrame += frameWidth;
+			outFrame += surface->w;
+		}
 	}
 
-	delete[] decompressedFrame;
-
-	uint32 audioChunkSize = _frameTotalSize[videoTrack->getCurFrame()] - (24 + compressedSize);
-
-// TODO: The audio chunk size below is usually correct, but there are some
-// exceptions (e.g. robot 4902 in Phantasmagoria, towards its end)
-#if 0
-	// Read frame audio header (14 bytes)
-	_fileStream->skip(2); // buffer position
-	_fileStream->skip(2); // unknown (usually 1)
-	_fileStream->skip(2); /*uint16 audioChunkSize = _fileStream->readUint16() + 8;*/
-	_fileStream->skip(2);
-#endif
-
-	// Queue the next audio frame
-	// FIXME: For some reason, there are audio hiccups/gaps
-	if (_header.hasSound) {
-		RobotAudioTrack *audioTrack = (RobotAudioTrack *)getTrack(1);
-		_fileStream->skip(8); // header
-		audioChunkSize -= 8;
-		audioTrack->queueBuffer(g_sci->_audio->getDecodedRobotAudioFrame(_fileStream, audioChunkSize), audioChunkSize * 2);
-	} else {
-		_fileStream->skip(audioChunkSize);
-	}
+	_decodedFrame = frame;
 }
 
 void RobotDecoder::readHeaderChunk() {
@@ -312,6 +413,12 @@ void RobotDecoder::readFrameSizesChunk() {
 	}
 #endif
 
+	// Allocate the frame buffer for the largest frame
+	_frameDataSize = 0;
+	for (int i = 0; i < _header.frameCount; ++i)
+		_frameDataSize = MAX(_frameDataSize, _frameTotalSize[i]);
+	_frameData = new byte[_frameDataSize];
+
 	// 2 more unknown tables
 	_fileStream->skip(1024 + 512);
 
@@ -49,6 +49,13 @@ public:
 	void setPos(uint16 x, uint16 y) { _pos = Common::Point(x, y); }
 	Common::Point getPos() const { return _pos; }
 
+	/**
+	 * Decode the next frame ahead of time, if it has not been decoded yet.
+	 * Meant to be called while waiting for the next frame to be due.
+	 * @return true if a frame has been decoded
+	 */
+	bool decodeAhead();
+
 protected:
 	void readNextPacket();
 
@@ -116,10 +123,29 @@ private:
 	void readHeaderChunk();
 	void readFrameSizesChunk();
 
+	/** Read the given frame from the file and queue its audio. */
+	void readFrame(int frame);
+	/** Decode the image of the given frame into _nextFrame. */
+	void decodeFrame(int frame);
+
 	Common::Point _pos;
 	bool _isBigEndian;
 	uint32 *_frameTotalSize;
 
+	// Buffers reused for every frame: the raw frame data, which is read
+	// with a single read call, and the decompressed cel data, for cels
+	// which can't be decompressed straight into the surface
+	byte *_frameData;
+	uint32 _frameDataSize;
+	byte *_celData;
+	uint32 _celDataSize;
+
+	// The back buffer the next frame is decoded into ahead of time, and the
+	// frames whose data is in _frameData and whose image is in _nextFrame
+	byte *_nextFrame;
+	int _readFrame;
+	int _decodedFrame;
+
 	Common::SeekableSubReadStreamEndian *_fileStream;
 };
 
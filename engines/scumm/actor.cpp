@@ -1009,8 +1009,8 @@ void Actor_v2::walkActor() {
 
 				_walkdata.curbox = next_box;
 
-				getClosestPtOnBox(_vm->getBoxCoordinates(_walkdata.curbox), _pos.x, _pos.y, tmp.x, tmp.y);
-				getClosestPtOnBox(_vm->getBoxCoordinates(_walkbox), tmp.x, tmp.y, foundPath.x, foundPath.y);
+				_vm->getClosestPtOnBox(_walkdata.curbox, _pos.x, _pos.y, tmp.x, tmp.y);
+				_vm->getClosestPtOnBox(_walkbox, tmp.x, tmp.y, foundPath.x, foundPath.y);
 			}
 			calcMovementFactor(foundPath);
 		}
@@ -1634,9 +1634,22 @@ AdjustBoxResult Actor::adjustXYToBeInBox(int dstX, int dstY) {
 		bestDist = (_vm->_game.version >= 7) ? 0x7FFFFFFF : 0xFFFF;
 		bestBox = kInvalidBox;
 
+		// With a threshold, only boxes near the point can pass the quick
+		// reject test below, so only those are looked at.
+		int numCandidates = 0;
+		const byte *candidates = NULL;
+		if (threshold > 0) {
+			assert(threshold <= ScummEngine::kBoxGridMargin);
+			candidates = _vm->getBoxesNearPoint(dstX, dstY, numCandidates);
+		}
+
 		// We iterate (backwards) over all boxes, searching the one closest
 		// to the desired coordinates.
-		for (box = numBoxes; box >= firstValidBox; box--) {
+		for (int i = (threshold > 0) ? numCandidates - 1 : numBoxes; i >= 0; i--) {
+			box = (threshold > 0) ? candidates[i] : i;
+			if (box < firstValidBox)
+				break;
+
 			flags = _vm->getBoxFlags(box);
 
 			// Skip over invisible boxes
@@ -1659,7 +1672,7 @@ AdjustBoxResult Actor::adjustXYToBeInBox(int dstX, int dstY) {
 			}
 
 			// Find the point in the box which is closest to our point.
-			tmpDist = getClosestPtOnBox(_vm->getBoxCoordinates(box), dstX, dstY, tmpX, tmpY);
+			tmpDist = _vm->getClosestPtOnBox(box, dstX, dstY, tmpX, tmpY);
 
 			// Check if the box is closer than the previous boxes.
 			if (tmpDist < bestDist) {
@@ -339,6 +339,7 @@ void AkosRenderer::setCostume(int costume, int shadow) {
 	const byte *akos = _vm->getResourceAddress(rtCostume, costume);
 	assert(akos);
 
+	_costumeId = costume;
 	akhd = (const AkosHeader *) _vm->findResourceData(MKTAG('A','K','H','D'), akos);
 	akof = (const AkosOffset *) _vm->findResourceData(MKTAG('A','K','O','F'), akos);
 	akci = _vm->findResourceData(MKTAG('A','K','C','I'), akos);
@@ -637,6 +638,86 @@ void AkosRenderer::codec1_genericDecode(Codec1 &v1) {
 	} while (1);
 }
 
+void AkosRenderer::codec1_drawCel(Codec1 &v1, const CostumeCel &cel, int column) {
+	// This draws exactly what codec1_genericDecode draws, but from the
+	// decoded cel.
+
+	// Figure out which screen row each row of the cel ends up in. Rows
+	// dropped by scaling and rows outside the bounds are marked with -1.
+	_celRowMap.resize(cel.height);
+	const byte *scaleytab = &v1.scaletable[v1.scaleYindex];
+	int row = 0;
+	for (int i = 0; i < cel.height; i++) {
+		if (_scaleY == 255 || *scaleytab++ < _scaleY) {
+			const int y = v1.y + row;
+			_celRowMap[i] = (y < v1.boundsRect.top || y >= v1.boundsRect.bottom) ? -1 : row;
+			row++;
+		} else {
+			_celRowMap[i] = -1;
+		}
+	}
+
+	const int maskOffset = _vm->_virtscr[kMainVirtScreen].xstart & 7;
+	byte maskbit = revBitMask(v1.x & 7);
+	bool skip_column = false;
+
+	while (true) {
+		if (!skip_column && v1.x >= 0 && v1.x < v1.boundsRect.right) {
+			const byte *mask = _vm->getMaskBuffer(v1.x - maskOffset, v1.y, _zbuf);
+
+			for (uint32 i = cel.columns[column]; i < cel.columns[column + 1]; i++) {
+				const CostumeCel::Span &span = cel.spans[i];
+				const byte *colors = &cel.colors[span.colors];
+
+				for (int j = 0; j < span.length; j++) {
+					row = _celRowMap[span.start + j];
+					if (row < 0 || (mask[row * _numStrips] & maskbit))
+						continue;
+
+					byte *dst = v1.destptr + row * _out.pitch;
+					uint16 pcolor = _palette[colors[j]];
+					if (_shadow_mode == 1) {
+						if (pcolor == 13)
+							pcolor = _shadow_table[*dst];
+					} else if (_shadow_mode == 3) {
+						if (_vm->_game.features & GF_16BIT_COLOR) {
+							uint16 srcColor = (pcolor >> 1) & 0x7DEF;
+							uint16 dstColor = (READ_UINT16(dst) >> 1) & 0x7DEF;
+							pcolor = srcColor + dstColor;
+						} else if (_vm->_game.heversion >= 90) {
+							pcolor = (pcolor << 8) + *dst;
+							pcolor = xmap[pcolor];
+						} else if (pcolor < 8) {
+							pcolor = (pcolor << 8) + *dst;
+							pcolor = _shadow_table[pcolor];
+						}
+					}
+					if (_vm->_bytesPerPixel == 2) {
+						WRITE_UINT16(dst, pcolor);
+					} else {
+						*dst = pcolor;
+					}
+				}
+			}
+		}
+
+		column++;
+		if (!--v1.skip_width)
+			return;
+
+		if (_scaleX == 255 || v1.scaletable[v1.scaleXindex] < _scaleX) {
+			v1.x += v1.scaleXstep;
+			if (v1.x < 0 || v1.x >= v1.boundsRect.right)
+				return;
+			maskbit = revBitMask(v1.x & 7);
+			v1.destptr += v1.scaleXstep * _vm->_bytesPerPixel;
+			skip_column = false;
+		} else
+			skip_column = true;
+		v1.scaleXindex += v1.scaleXstep;
+	}
+}
+
 // This is exact duplicate of smallCostumeScaleTable[] in costume.cpp
 // See FIXME below for explanation
 const byte smallCostumeScaleTableAKOS[256] = {
@@ -941,6 +1022,11 @@ byte AkosRenderer::codec1(int xmoveCur, int ymoveCur) {
 
 	v1.replen = 0;
 
+	// Remember where the cel data starts, before codec1_ignorePakCols
+	// skips any columns.
+	const byte *celptr = _srcptr;
+	int skippedColumns = 0;
+
 	if (_mirror) {
 		if (!use_scaling)
 			skip = v1.boundsRect.left - v1.x;
@@ -948,6 +1034,7 @@ byte AkosRenderer::codec1(int xmoveCur, int ymoveCur) {
 		if (skip > 0) {
 			v1.skip_width -= skip;
 			codec1_ignorePakCols(v1, skip);
+			skippedColumns = skip;
 			v1.x = v1.boundsRect.left;
 		} else {
 			skip = rect.right - v1.boundsRect.right;
@@ -963,6 +1050,7 @@ byte AkosRenderer::codec1(int xmoveCur, int ymoveCur) {
 		if (skip > 0) {
 			v1.skip_width -= skip;
 			codec1_ignorePakCols(v1, skip)	;
+			skippedColumns = skip;
 			v1.x = v1.boundsRect.right - 1;
 		} else {
 			skip = (v1.boundsRect.left -1) - rect.left;
@@ -996,6 +1084,19 @@ byte AkosRenderer::codec1(int xmoveCur, int ymoveCur) {
 
 	v1.destptr = (byte *)_out.getBasePtr(v1.x, v1.y);
 
+	// Hit tests, the (unimplemented) shadow mode 2 and a skip that stopped
+	// right at the start of a 256 pixel run (see ClassicCostumeRenderer)
+	// are left to the generic decoder.
+	if (!_actorHitMode && _shadow_mode != 2 && (!skippedColumns || v1.replen)) {
+		const byte *akos = _vm->getResourceAddress(rtCostume, _costumeId);
+		const CostumeCel *cel = _celCache.getCel(_costumeId, akos, _vm->getResourceSize(rtCostume, _costumeId),
+		                                         celptr, _width, _height, v1.mask, v1.shr);
+		if (cel) {
+			codec1_drawCel(v1, *cel, skippedColumns);
+			return drawFlag;
+		}
+	}
+
 	codec1_genericDecode(v1);
 
 	return drawFlag;
@@ -54,6 +54,7 @@ protected:
 
 class AkosRenderer : public BaseCostumeRenderer {
 protected:
+	int _costumeId;
 	uint16 _codec;
 
 	// actor _palette
@@ -87,6 +88,7 @@ protected:
 
 public:
 	AkosRenderer(ScummEngine *scumm) : BaseCostumeRenderer(scumm) {
+		_costumeId = -1;
 		_useBompPalette = false;
 		akhd = 0;
 		akpl = 0;
@@ -113,6 +115,7 @@ protected:
 
 	byte codec1(int xmoveCur, int ymoveCur);
 	void codec1_genericDecode(Codec1 &v1);
+	void codec1_drawCel(Codec1 &v1, const CostumeCel &cel, int column);
 	byte codec5(int xmoveCur, int ymoveCur);
 	byte codec16(int xmoveCur, int ymoveCur);
 	byte codec32(int xmoveCur, int ymoveCur);
@@ -58,6 +58,124 @@ byte BaseCostumeRenderer::drawCostume(const VirtScreen &vs, int numStrips, const
 	return result;
 }
 
+bool CostumeCel::decode(const byte *src, const byte *end, int w, int h, byte m, byte s) {
+	width = w;
+	height = h;
+	mask = m;
+	shr = s;
+
+	// Unpack the RLE data column by column. Runs may continue across
+	// column boundaries, and a run length of 0 stands for 256 pixels, just
+	// like in the drawing routines.
+	const uint32 numPixels = w * h;
+	Common::Array<byte> pixels;
+	pixels.resize(numPixels);
+
+	uint32 pos = 0;
+	while (pos < numPixels) {
+		if (src >= end)
+			return false;
+		uint len = *src++;
+		const byte color = len >> s;
+		len &= m;
+		if (!len) {
+			if (src >= end)
+				return false;
+			len = *src++;
+		}
+		if (!len)
+			len = 256;
+
+		len = MIN<uint32>(len, numPixels - pos);
+		memset(&pixels[pos], color, len);
+		pos += len;
+	}
+
+	// Collect the runs of opaque pixels of each column.
+	columns.clear();
+	spans.clear();
+	colors.clear();
+	columns.reserve(w + 1);
+
+	for (int x = 0; x < w; x++) {
+		const byte *column = &pixels[x * h];
+		columns.push_back(spans.size());
+
+		int y = 0;
+		while (y < h) {
+			if (!column[y]) {
+				y++;
+				continue;
+			}
+
+			Span span;
+			span.start = y;
+			span.colors = colors.size();
+			while (y < h && column[y])
+				colors.push_back(column[y++]);
+			span.length = y - span.start;
+			spans.push_back(span);
+		}
+	}
+	columns.push_back(spans.size());
+
+	return true;
+}
+
+uint32 CostumeCel::getMemorySize() const {
+	return sizeof(CostumeCel) + columns.size() * sizeof(uint32) + spans.size() * sizeof(Span) + colors.size();
+}
+
+CostumeCelCache::CostumeCelCache() : _memoryUsed(0) {
+}
+
+CostumeCelCache::~CostumeCelCache() {
+	clear();
+}
+
+const CostumeCel *CostumeCelCache::getCel(int costume, const byte *res, uint32 resSize, const byte *src, int width, int height, byte mask, byte shr) {
+	if (!res || src < res || src >= res + resSize || width <= 0 || height <= 0 || height > 0xFFFF)
+		return 0;
+
+	CelKey key;
+	key.costume = costume;
+	key.offset = src - res;
+
+	CelMap::iterator i = _cels.find(key);
+	if (i != _cels.end()) {
+		const CostumeCel *cel = i->_value;
+		if (cel->width == width && cel->height == height && cel->mask == mask && cel->shr == shr)
+			return cel;
+
+		_memoryUsed -= cel->getMemorySize();
+		delete cel;
+		_cels.erase(i);
+	}
+
+	CostumeCel *cel = new CostumeCel();
+	if (!cel->decode(src, res + resSize, width, height, mask, shr)) {
+		delete cel;
+		return 0;
+	}
+
+	// Start over once the budget is used up. The cels of the actors on
+	// screen are decoded again quickly.
+	const uint32 size = cel->getMemorySize();
+	if (_memoryUsed + size > kMaxMemory)
+		clear();
+
+	_cels[key] = cel;
+	_memoryUsed += size;
+	return cel;
+}
+
+void CostumeCelCache::clear() {
+	for (CelMap::iterator i = _cels.begin(); i != _cels.end(); ++i)
+		delete i->_value;
+	_cels.clear();
+	_memoryUsed = 0;
+}
+
 void BaseCostumeRenderer::codec1_ignorePakCols(Codec1 &v1, int num) {
 	num *= _height;
 
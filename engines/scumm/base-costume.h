@@ -24,6 +24,8 @@
 #define SCUMM_BASE_COSTUME_H
 
 #include "common/scummsys.h"
+#include "common/array.h"
+#include "common/hashmap.h"
 #include "scumm/actor.h"		// for CostumeData
 
 namespace Scumm {
@@ -47,6 +49,87 @@ class Actor;
 class ScummEngine;
 struct VirtScreen;
 
+/**
+ * A cel in the column based RLE format used by classic costumes and by
+ * AKOS codec 1, decoded into runs of opaque pixels ("spans") per column.
+ * Drawing from this skips all transparent pixels without looking at them
+ * and does not need to decode the RLE data again.
+ */
+struct CostumeCel {
+	struct Span {
+		uint16 start;	///< first row covered by the span
+		uint16 length;	///< number of rows covered by the span
+		uint32 colors;	///< offset of the span's colors in _colors
+	};
+
+	int width, height;
+	byte mask, shr;
+
+	/** Index of the first span of each column, plus an end marker. */
+	Common::Array<uint32> columns;
+	Common::Array<Span> spans;
+	Common::Array<byte> colors;
+
+	/**
+	 * Decode the RLE data of a cel.
+	 *
+	 * @param src	the RLE data
+	 * @param end	end of the resource the data is contained in
+	 * @return false if the data is truncated
+	 */
+	bool decode(const byte *src, const byte *end, int w, int h, byte m, byte s);
+
+	uint32 getMemorySize() const;
+};
+
+/**
+ * Cache of decoded costume cels, bounded by the memory it uses.
+ */
+class CostumeCelCache {
+public:
+	CostumeCelCache();
+	~CostumeCelCache();
+
+	/**
+	 * Return the decoded cel for the RLE data at src, decoding it if it is
+	 * not in the cache yet.
+	 *
+	 * @param costume	id of the costume resource containing the cel
+	 * @param res		start of the costume resource
+	 * @param resSize	size of the costume resource
+	 * @param src		start of the cel's RLE data
+	 * @return the decoded cel, or 0 if the cel could not be decoded. The
+	 *         cel is only valid until the next call.
+	 */
+	const CostumeCel *getCel(int costume, const byte *res, uint32 resSize, const byte *src, int width, int height, byte mask, byte shr);
+
+	void clear();
+
+private:
+	enum {
+		kMaxMemory = 2 * 1024 * 1024
+	};
+
+	struct CelKey {
+		int costume;
+		uint32 offset;
+
+		bool operator==(const CelKey &other) const {
+			return costume == other.costume && offset == other.offset;
+		}
+	};
+
+	struct CelKeyHash {
+		uint operator()(const CelKey &key) const {
+			return key.costume * 65599 + key.offset;
+		}
+	};
+
+	typedef Common::HashMap<CelKey, CostumeCel *, CelKeyHash> CelMap;
+	CelMap _cels;
+	uint32 _memoryUsed;
+};
+
 class BaseCostumeLoader {
 protected:
 	ScummEngine *_vm;
@@ -105,6 +188,13 @@ protected:
 	// width and height of cel to decode
 	int _width, _height;
 
+	// decoded cels, see CostumeCel
+	CostumeCelCache _celCache;
+
+	// screen row of each cel row while drawing a CostumeCel, or -1 if
+	// the row is skipped
+	Common::Array<int> _celRowMap;
+
 public:
 	struct Codec1 {
 		// Parameters for the original ("V1") costume codec.
@@ -199,6 +199,9 @@ void ScummEngine::setBoxFlags(int box, int val) {
 		Box *ptr = getBoxBaseAddr(box);
 		if (!ptr)
 			return;
+		// v0 boxes are shorter than the v2 layout written below
+		if (_game.version == 0)
+			invalidateBoxCache();
 		if (_game.version == 8)
 			ptr->v8.flags = TO_LE_32(val);
 		else if (_game.version <= 2)
@@ -571,7 +574,145 @@ bool ScummEngine::checkXYInBoxBounds(int boxnum, int x, int y) {
 	return true;
 }
 
+void ScummEngine::buildBoxCache() {
+	const int numBoxes = getNumBoxes();
+
+	_boxCache.resize(numBoxes);
+	for (int i = 0; i < numBoxes; i++) {
+		_boxCache[i].coords = readBoxCoordinates(i);
+		_boxCache[i].closestValid = false;
+	}
+
+	// Bounds of every box grown by the grid margin, as inclusive
+	// left, top, right, bottom
+	Common::Array<int> bounds;
+	bounds.resize(numBoxes * 4);
+	int left = 0, top = 0, right = -1, bottom = -1;
+	for (int i = 0; i < numBoxes; i++) {
+		const BoxCoords &box = _boxCache[i].coords;
+		int *b = &bounds[i * 4];
+		b[0] = MIN(MIN(box.ul.x, box.ur.x), MIN(box.ll.x, box.lr.x)) - kBoxGridMargin;
+		b[1] = MIN(MIN(box.ul.y, box.ur.y), MIN(box.ll.y, box.lr.y)) - kBoxGridMargin;
+		b[2] = MAX(MAX(box.ul.x, box.ur.x), MAX(box.ll.x, box.lr.x)) + kBoxGridMargin;
+		b[3] = MAX(MAX(box.ul.y, box.ur.y), MAX(box.ll.y, box.lr.y)) + kBoxGridMargin;
+		if (i == 0 || b[0] < left)
+			left = b[0];
+		if (i == 0 || b[1] < top)
+			top = b[1];
+		if (i == 0 || b[2] > right)
+			right = b[2];
+		if (i == 0 || b[3] > bottom)
+			bottom = b[3];
+	}
+
+	_boxGridLeft = left;
+	_boxGridTop = top;
+	_boxGridCellSize = 32;
+	do {
+		_boxGridColumns = (right - left) / _boxGridCellSize + 1;
+		_boxGridRows = (bottom - top) / _boxGridCellSize + 1;
+		if (_boxGridColumns * _boxGridRows <= kBoxGridMaxCells)
+			break;
+		_boxGridCellSize *= 2;
+	} while (true);
+	if (numBoxes == 0)
+		_boxGridColumns = _boxGridRows = 0;
+
+	const int numCells = _boxGridColumns * _boxGridRows;
+
+	// Count the boxes of each cell, then fill them in, in box order
+	_boxGridStart.resize(numCells + 1);
+	for (int c = 0; c <= numCells; c++)
+		_boxGridStart[c] = 0;
+	for (int pass = 0; pass < 2; pass++) {
+		Common::Array<uint32> next;
+		if (pass == 1) {
+			uint32 total = 0;
+			for (int c = 0; c <= numCells; c++) {
+				const uint32 count = _boxGridStart[c];
+				_boxGridStart[c] = total;
+				total += count;
+			}
+			_boxGridBoxes.resize(total);
+			next = _boxGridStart;
+		}
+
+		for (int i = 0; i < numBoxes; i++) {
+			const int *b = &bounds[i * 4];
+			const int x1 = (b[0] - _boxGridLeft) / _boxGridCellSize;
+			const int y1 = (b[1] - _boxGridTop) / _boxGridCellSize;
+			const int x2 = (b[2] - _boxGridLeft) / _boxGridCellSize;
+			const int y2 = (b[3] - _boxGridTop) / _boxGridCellSize;
+			for (int y = y1; y <= y2; y++) {
+				for (int x = x1; x <= x2; x++) {
+					const int cell = y * _boxGridColumns + x;
+					if (pass == 0)
+						_boxGridStart[cell]++;
+					else
+						_boxGridBoxes[next[cell]++] = i;
+				}
+			}
+		}
+	}
+
+	_boxCacheValid = true;
+}
+
+/**
+ * Returns the boxes which may lie within kBoxGridMargin pixels of the given
+ * point, in ascending order. Boxes not in the list are certainly farther
+ * away.
+ */
+const byte *ScummEngine::getBoxesNearPoint(int x, int y, int &numBoxes) {
+	if (!_boxCacheValid)
+		buildBoxCache();
+
+	numBoxes = 0;
+	if (x < _boxGridLeft || y < _boxGridTop)
+		return NULL;
+
+	const int column = (x - _boxGridLeft) / _boxGridCellSize;
+	const int row = (y - _boxGridTop) / _boxGridCellSize;
+	if (column >= _boxGridColumns || row >= _boxGridRows)
+		return NULL;
+
+	const int cell = row * _boxGridColumns + column;
+	numBoxes = _boxGridStart[cell + 1] - _boxGridStart[cell];
+	return numBoxes ? &_boxGridBoxes[_boxGridStart[cell]] : NULL;
+}
+
 BoxCoords ScummEngine::getBoxCoordinates(int boxnum) {
+	if (!_boxCacheValid)
+		buildBoxCache();
+
+	if (boxnum >= 0 && boxnum < (int)_boxCache.size())
+		return _boxCache[boxnum].coords;
+
+	// Let readBoxCoordinates() deal with out of range boxes
+	return readBoxCoordinates(boxnum);
+}
+
+int ScummEngine::getClosestPtOnBox(int boxnum, int x, int y, int16 &outX, int16 &outY) {
+	if (!_boxCacheValid)
+		buildBoxCache();
+
+	if (boxnum < 0 || boxnum >= (int)_boxCache.size())
+		return Scumm::getClosestPtOnBox(getBoxCoordinates(boxnum), x, y, outX, outY);
+
+	BoxCacheEntry &entry = _boxCache[boxnum];
+	if (!entry.closestValid || entry.closestQueryX != x || entry.closestQueryY != y) {
+		entry.closestDist = Scumm::getClosestPtOnBox(entry.coords, x, y, entry.closestX, entry.closestY);
+		entry.closestQueryX = x;
+		entry.closestQueryY = y;
+		entry.closestValid = true;
+	}
+
+	outX = entry.closestX;
+	outY = entry.closestY;
+	return entry.closestDist;
+}
+
+BoxCoords ScummEngine::readBoxCoordinates(int boxnum) {
 	BoxCoords tmp, *box = &tmp;
 	Box *bp = getBoxBaseAddr(boxnum);
 	assert(bp);
@@ -1171,7 +1312,7 @@ byte ScummEngine_v0::walkboxFindTarget(Actor *a, int destbox, Common::Point walk
 
 	if (nextBox != 0xFF && nextBox != a->_walkbox) {
 
-		getClosestPtOnBox(getBoxCoordinates(nextBox), a->getPos().x, a->getPos().y, Actor->_NewWalkTo.x, Actor->_NewWalkTo.y);
+		getClosestPtOnBox(nextBox, a->getPos().x, a->getPos().y, Actor->_NewWalkTo.x, Actor->_NewWalkTo.y);
 
 	} else {
 		if (walkdest.x == -1)
@@ -72,6 +72,68 @@ static const int v1MMNESLookup[25] = {
 	0x17, 0x00, 0x01, 0x05, 0x16
 };
 
+void ClassicCostumeRenderer::drawCel(Codec1 &v1, const CostumeCel &cel, int column) {
+	// This draws exactly what proc3 draws, but from the decoded cel.
+
+	// Figure out which screen row each row of the cel ends up in. Rows
+	// dropped by scaling and rows outside the screen are marked with -1.
+	_celRowMap.resize(cel.height);
+	byte scaleIndexY = _scaleIndexY;
+	int row = 0;
+	for (int i = 0; i < cel.height; i++) {
+		if (_scaleY == 255 || v1.scaletable[scaleIndexY++] < _scaleY) {
+			const int y = v1.y + row;
+			_celRowMap[i] = (y < 0 || y >= _out.h) ? -1 : row;
+			row++;
+		} else {
+			_celRowMap[i] = -1;
+		}
+	}
+
+	byte maskbit = revBitMask(v1.x & 7);
+
+	while (true) {
+		if (v1.x >= 0 && v1.x < _out.w) {
+			const byte *mask = v1.mask_ptr ? v1.mask_ptr + v1.x / 8 : 0;
+
+			for (uint32 i = cel.columns[column]; i < cel.columns[column + 1]; i++) {
+				const CostumeCel::Span &span = cel.spans[i];
+				const byte *colors = &cel.colors[span.colors];
+
+				for (int j = 0; j < span.length; j++) {
+					row = _celRowMap[span.start + j];
+					if (row < 0 || (mask && (mask[row * _numStrips] & maskbit)))
+						continue;
+
+					byte *dst = v1.destptr + row * _out.pitch;
+					uint pcolor;
+					if (_shadow_mode & 0x20) {
+						pcolor = _shadow_table[*dst];
+					} else {
+						pcolor = _palette[colors[j]];
+						if (pcolor == 13 && _shadow_table)
+							pcolor = _shadow_table[*dst];
+					}
+					*dst = pcolor;
+				}
+			}
+		}
+
+		column++;
+		if (!--v1.skip_width)
+			return;
+
+		if (_scaleX == 255 || v1.scaletable[_scaleIndexX] < _scaleX) {
+			v1.x += v1.scaleXstep;
+			if (v1.x < 0 || v1.x >= _out.w)
+				return;
+			maskbit = revBitMask(v1.x & 7);
+			v1.destptr += v1.scaleXstep;
+		}
+		_scaleIndexX += v1.scaleXstep;
+	}
+}
+
 byte ClassicCostumeRenderer::mainRoutine(int xmoveCur, int ymoveCur) {
 	int i, skip = 0;
 	byte drawFlag = 1;
@@ -230,6 +292,11 @@ byte ClassicCostumeRenderer::mainRoutine(int xmoveCur, int ymoveCur) {
 
 	v1.replen = 0;
 
+	// Remember where the cel data starts, before codec1_ignorePakCols
+	// skips any columns.
+	const byte *celptr = _srcptr;
+	int skippedColumns = 0;
+
 	if (_mirror) {
 		if (!use_scaling)
 			skip = -v1.x;
@@ -237,6 +304,7 @@ byte ClassicCostumeRenderer::mainRoutine(int xmoveCur, int ymoveCur) {
 			if (!newAmiCost && !pcEngCost && _loaded._format != 0x57) {
 				v1.skip_width -= skip;
 				codec1_ignorePakCols(v1, skip);
+				skippedColumns = skip;
 				v1.x = 0;
 			}
 		} else {
@@ -254,6 +322,7 @@ byte ClassicCostumeRenderer::mainRoutine(int xmoveCur, int ymoveCur) {
 			if (!newAmiCost && !pcEngCost && _loaded._format != 0x57) {
 				v1.skip_width -= skip;
 				codec1_ignorePakCols(v1, skip);
+				skippedColumns = skip;
 				v1.x = _out.w - 1;
 			}
 		} else {
@@ -305,8 +374,21 @@ byte ClassicCostumeRenderer::mainRoutine(int xmoveCur, int ymoveCur) {
 		proc3_ami(v1);
 	else if (pcEngCost)
 		procPCEngine(v1);
-	else
-		proc3(v1);
+	else {
+		// If codec1_ignorePakCols stopped right at the start of a 256 pixel
+		// run, proc3 skips the rest of that run; keep that quirk by not
+		// using the decoded cel.
+		const CostumeCel *cel = 0;
+		if (!skippedColumns || v1.replen) {
+			const byte *res = _vm->getResourceAddress(rtCostume, _loaded._id);
+			cel = _celCache.getCel(_loaded._id, res, _vm->getResourceSize(rtCostume, _loaded._id),
+			                       celptr, _width, _height, v1.mask, v1.shr);
+		}
+		if (cel)
+			drawCel(v1, *cel, skippedColumns);
+		else
+			proc3(v1);
+	}
 
 	return drawFlag;
 }
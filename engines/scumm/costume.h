@@ -101,6 +101,12 @@ protected:
 	void proc3(Codec1 &v1);
 	void proc3_ami(Codec1 &v1);
 
+	/**
+	 * Draw a decoded cel, starting with the given column. This is the
+	 * equivalent of proc3.
+	 */
+	void drawCel(Codec1 &v1, const CostumeCel &cel, int column);
+
 	void procC64(Codec1 &v1, int actor);
 
 	void procPCEngine(Codec1 &v1);
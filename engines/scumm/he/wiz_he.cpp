@@ -645,6 +645,16 @@ void Wiz::copyRaw16BitWizImage(uint8 *dst, const uint8 *src, int dstPitch, int d
 		int w = r1.width();
 		src += (r1.top * srcw + r1.left) * 2;
 		dst += r2.top * dstPitch + r2.left * 2;
+#ifdef SCUMM_LITTLE_ENDIAN
+		if (transColor == -1) {
+			while (h--) {
+				memcpy(dst, src, w * 2);
+				src += srcw * 2;
+				dst += dstPitch;
+			}
+			return;
+		}
+#endif
 		while (h--) {
 			for (int i = 0; i < w; ++ i) {
 				uint16 col = READ_LE_UINT16(src + 2 * i);
@@ -770,9 +780,17 @@ void Wiz::decompress16BitWizImage(uint8 *dst, int dstPitch, int dstType, const u
 					if (w < 0) {
 						code += w;
 					}
-					while (code--) {
-						write16BitColor<type>(dstPtr, dataPtr, dstType, xmapPtr);
-						dstPtr += dstInc;
+					if (type == kWizCopy) {
+						const uint16 color = READ_LE_UINT16(dataPtr);
+						while (code--) {
+							writeColor(dstPtr, dstType, color);
+							dstPtr += dstInc;
+						}
+					} else {
+						while (code--) {
+							write16BitColor<type>(dstPtr, dataPtr, dstType, xmapPtr);
+							dstPtr += dstInc;
+						}
 					}
 					dataPtr += 2;
 				} else {
@@ -790,6 +808,16 @@ void Wiz::decompress16BitWizImage(uint8 *dst, int dstPitch, int dstType, const u
 					if (w < 0) {
 						code += w;
 					}
+#ifdef SCUMM_LITTLE_ENDIAN
+					// Source and destination are both little endian here,
+					// whatever the destination type.
+					if (type == kWizCopy && dstInc == 2) {
+						memcpy(dstPtr, dataPtr, code * 2);
+						dataPtr += code * 2;
+						dstPtr += code * 2;
+						continue;
+					}
+#endif
 					while (code--) {
 						write16BitColor<type>(dstPtr, dataPtr, dstType, xmapPtr);
 						dataPtr += 2;
@@ -904,9 +932,20 @@ void Wiz::decompressWizImage(uint8 *dst, int dstPitch, int dstType, const uint8
 					if (w < 0) {
 						code += w;
 					}
-					while (code--) {
-						write8BitColor<type>(dstPtr, dataPtr, dstType, palPtr, xmapPtr, bitDepth);
-						dstPtr += dstInc;
+					if (type != kWizXMap && dstInc == 1) {
+						memset(dstPtr, (type == kWizRMap) ? palPtr[*dataPtr] : *dataPtr, code);
+						dstPtr += code;
+					} else if (type != kWizXMap && bitDepth == 2) {
+						const uint16 color = (type == kWizRMap) ? READ_LE_UINT16(palPtr + *dataPtr * 2) : *dataPtr;
+						while (code--) {
+							writeColor(dstPtr, dstType, color);
+							dstPtr += dstInc;
+						}
+					} else {
+						while (code--) {
+							write8BitColor<type>(dstPtr, dataPtr, dstType, palPtr, xmapPtr, bitDepth);
+							dstPtr += dstInc;
+						}
 					}
 					dataPtr++;
 				} else {
@@ -924,10 +963,19 @@ void Wiz::decompressWizImage(uint8 *dst, int dstPitch, int dstType, const uint8
 					if (w < 0) {
 						code += w;
 					}
-					while (code--) {
-						write8BitColor<type>(dstPtr, dataPtr, dstType, palPtr, xmapPtr, bitDepth);
-						dataPtr++;
-						dstPtr += dstInc;
+					if (type == kWizCopy && dstInc == 1) {
+						memcpy(dstPtr, dataPtr, code);
+						dataPtr += code;
+						dstPtr += code;
+					} else if (type == kWizRMap && dstInc == 1) {
+						while (code--)
+							*dstPtr++ = palPtr[*dataPtr++];
+					} else {
+						while (code--) {
+							write8BitColor<type>(dstPtr, dataPtr, dstType, palPtr, xmapPtr, bitDepth);
+							dataPtr++;
+							dstPtr += dstInc;
+						}
 					}
 				}
 			}
@@ -951,6 +999,20 @@ void Wiz::decompressRawWizImage(uint8 *dst, int dstPitch, int dstType, const uin
 	if (w <= 0 || h <= 0) {
 		return;
 	}
+	if (transColor == -1 && bitDepth == 1) {
+		// Opaque 8 bit images are plain row copies or lookups
+		while (h--) {
+			if (type == kWizRMap) {
+				for (int i = 0; i < w; ++i)
+					dst[i] = palPtr[src[i]];
+			} else {
+				memcpy(dst, src, w);
+			}
+			src += srcPitch;
+			dst += dstPitch;
+		}
+		return;
+	}
 	while (h--) {
 		for (int i = 0; i < w; ++i) {
 			uint8 col = src[i];
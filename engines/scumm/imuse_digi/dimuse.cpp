@@ -49,6 +49,7 @@ IMuseDigital::IMuseDigital(ScummEngine_v7 *scumm, Audio::Mixer *mixer, int fps)
 	assert(mixer);
 
 	_pause = false;
+	_prefetch = true;
 	_sound = new ImuseDigiSndMgr(_vm);
 	assert(_sound);
 	_callbackFps = fps;
@@ -208,6 +209,38 @@ void IMuseDigital::saveOrLoad(Serializer *ser) {
 	}
 }
 
+void IMuseDigital::prefetch() {
+	Common::StackLock lock(_mutex, "IMuseDigital::prefetch()");
+
+	if (_pause || !_prefetch)
+		return;
+
+	// Decompress the bundle blocks the active tracks will need during the
+	// next second, a few at a time, so callback() finds them in the
+	// bundle block cache instead of decompressing them itself.
+	int budget = 4;
+	for (int l = 0; l < MAX_DIGITAL_TRACKS + MAX_DIGITAL_FADETRACKS && budget > 0; l++) {
+		Track *track = _track[l];
+		if (!track->used || !track->stream || track->souStreamUsed || !track->soundDesc || track->curRegion == -1)
+			continue;
+
+		int32 offset = track->regionOffset;
+		int32 size = track->feedSize;
+		if (_sound->getBits(track->soundDesc) == 12) {
+			offset = (offset * 3) / 4;
+			size = (size * 3) / 4;
+		}
+
+		int decoded = _sound->prefetchDataFromRegion(track->soundDesc, track->curRegion, offset, size, budget);
+		if (decoded < 0) {
+			// The block cache is disabled, prefetched blocks would be lost
+			_prefetch = false;
+			return;
+		}
+		budget -= decoded;
+	}
+}
+
 void IMuseDigital::callback() {
 	Common::StackLock lock(_mutex, "IMuseDigital::callback()");
 
@@ -78,6 +78,7 @@ private:
 	int32 _numAudioNames;	// number of above filenames
 
 	bool _pause;			// flag mean that iMuse callback should be idle
+	bool _prefetch;			// whether the bundle block cache takes prefetched blocks
 
 	int32 _attributes[188];	// internal attributes for each music file to store and check later
 	int32 _nextSeqToPlay;	// id of sequence type of music needed played
@@ -150,6 +151,7 @@ public:
 	void stopSound(int sound);
 	void stopAllSounds();
 	void pause(bool pause);
+	void prefetch();
 	void parseScriptCmds(int cmd, int soundId, int sub_cmd, int d, int e, int f, int g, int h);
 	void refreshScripts();
 	void flushTracks();
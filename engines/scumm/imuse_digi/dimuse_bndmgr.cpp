@@ -38,6 +38,9 @@ BundleDirCache::BundleDirCache() {
 		_budleDirCache[fileId].isCompressed = false;
 		_budleDirCache[fileId].indexTable = NULL;
 	}
+	_blockCacheSize = kDefaultBlockCacheSize;
+	_blockCacheUsed = 0;
+	_blockCacheTick = 0;
 }
 
 BundleDirCache::~BundleDirCache() {
@@ -45,6 +48,7 @@ BundleDirCache::~BundleDirCache() {
 		free(_budleDirCache[fileId].bundleTable);
 		free(_budleDirCache[fileId].indexTable);
 	}
+	setBlockCacheSize(0);
 }
 
 BundleDirCache::AudioTable *BundleDirCache::getTable(int slot) {
@@ -63,6 +67,63 @@ bool BundleDirCache::isSndDataExtComp(int slot) {
 	return _budleDirCache[slot].isCompressed;
 }
 
+void BundleDirCache::setBlockCacheSize(uint32 size) {
+	_blockCacheSize = size;
+	evictBlocks(0);
+}
+
+void BundleDirCache::evictBlocks(uint32 needed) {
+	while (!_blocks.empty() && _blockCacheUsed + needed > _blockCacheSize) {
+		BlockMap::iterator oldest = _blocks.begin();
+		for (BlockMap::iterator i = _blocks.begin(); i != _blocks.end(); ++i) {
+			if (i->_value.lastUse < oldest->_value.lastUse)
+				oldest = i;
+		}
+
+		_blockCacheUsed -= oldest->_value.size;
+		free(oldest->_value.data);
+		_blocks.erase(oldest);
+	}
+}
+
+const byte *BundleDirCache::getBlock(int slot, int32 index, int32 block, int32 &size) {
+	BlockKey key = { slot, index, block };
+	BlockMap::iterator i = _blocks.find(key);
+	if (i == _blocks.end())
+		return NULL;
+
+	i->_value.lastUse = ++_blockCacheTick;
+	size = i->_value.size;
+	return i->_value.data;
+}
+
+bool BundleDirCache::hasBlock(int slot, int32 index, int32 block) const {
+	BlockKey key = { slot, index, block };
+	return _blocks.contains(key);
+}
+
+bool BundleDirCache::storeBlock(int slot, int32 index, int32 block, const byte *data, int32 size) {
+	if (hasBlock(slot, index, block))
+		return true;
+	if (size <= 0 || (uint32)size > _blockCacheSize)
+		return false;
+
+	evictBlocks(size);
+
+	CachedBlock cached;
+	cached.data = (byte *)malloc(size);
+	if (!cached.data)
+		return false;
+	memcpy(cached.data, data, size);
+	cached.size = size;
+	cached.lastUse = ++_blockCacheTick;
+
+	BlockKey key = { slot, index, block };
+	_blocks[key] = cached;
+	_blockCacheUsed += size;
+	return true;
+}
+
 int BundleDirCache::matchFile(const char *filename) {
 	int32 tag, offset;
 	bool found = false;
@@ -143,6 +204,7 @@ BundleMgr::BundleMgr(BundleDirCache *cache) {
 	_cache = cache;
 	_bundleTable = NULL;
 	_compTable = NULL;
+	_slot = -1;
 	_numFiles = 0;
 	_numCompItems = 0;
 	_curSampleId = -1;
@@ -184,13 +246,13 @@ bool BundleMgr::open(const char *filename, bool &compressed, bool errorFlag) {
 		return false;
 	}
 
-	int slot = _cache->matchFile(filename);
-	assert(slot != -1);
-	compressed = _cache->isSndDataExtComp(slot);
-	_numFiles = _cache->getNumFiles(slot);
+	_slot = _cache->matchFile(filename);
+	assert(_slot != -1);
+	compressed = _cache->isSndDataExtComp(_slot);
+	_numFiles = _cache->getNumFiles(_slot);
 	assert(_numFiles);
-	_bundleTable = _cache->getTable(slot);
-	_indexTable = _cache->getIndexTable(slot);
+	_bundleTable = _cache->getTable(_slot);
+	_indexTable = _cache->getIndexTable(_slot);
 	assert(_bundleTable);
 	_compTableLoaded = false;
 	_outputSize = 0;
@@ -287,19 +349,7 @@ int32 BundleMgr::decompressSampleByIndex(int32 index, int32 offset, int32 size,
 	skip = (offset + headerSize) % 0x2000;
 
 	for (i = firstBlock; i <= lastBlock; i++) {
-		if (_lastBlock != i) {
-			// CMI hack: one more zero byte at the end of input buffer
-			_compInputBuff[_compTable[i].size] = 0;
-			_file->seek(_bundleTable[index].offset + _compTable[i].offset, SEEK_SET);
-			_file->read(_compInputBuff, _compTable[i].size);
-			_outputSize = BundleCodecs::decompressCodec(_compTable[i].codec, _compInputBuff, _compOutputBuff, _compTable[i].size);
-			if (_outputSize > 0x2000) {
-				error("_outputSize: %d", _outputSize);
-			}
-			_lastBlock = i;
-		}
-
-		outputSize = _outputSize;
+		const byte *block = getBlock(index, i, outputSize);
 
 		if (headerOutside) {
 			outputSize -= skip;
@@ -316,7 +366,7 @@ int32 BundleMgr::decompressSampleByIndex(int32 index, int32 offset, int32 size,
 
 		assert(finalSize + outputSize <= blocksFinalSize);
 
-		memcpy(*compFinal + finalSize, _compOutputBuff + skip, outputSize);
+		memcpy(*compFinal + finalSize, block + skip, outputSize);
 		finalSize += outputSize;
 
 		size -= outputSize;
@@ -330,6 +380,59 @@ int32 BundleMgr::decompressSampleByIndex(int32 index, int32 offset, int32 size,
 	return finalSize;
 }
 
+bool BundleMgr::decompressBlock(int32 index, int32 block) {
+	// CMI hack: one more zero byte at the end of input buffer
+	_compInputBuff[_compTable[block].size] = 0;
+	_file->seek(_bundleTable[index].offset + _compTable[block].offset, SEEK_SET);
+	_file->read(_compInputBuff, _compTable[block].size);
+	_outputSize = BundleCodecs::decompressCodec(_compTable[block].codec, _compInputBuff, _compOutputBuff, _compTable[block].size);
+	if (_outputSize > 0x2000) {
+		error("_outputSize: %d", _outputSize);
+	}
+	_lastBlock = block;
+
+	return _cache->storeBlock(_slot, index, block, _compOutputBuff, _outputSize);
+}
+
+const byte *BundleMgr::getBlock(int32 index, int32 block, int32 &outputSize) {
+	if (_lastBlock != block) {
+		const byte *cached = _cache->getBlock(_slot, index, block, outputSize);
+		if (cached)
+			return cached;
+
+		decompressBlock(index, block);
+	}
+
+	outputSize = _outputSize;
+	return _compOutputBuff;
+}
+
+int BundleMgr::prefetchByCurIndex(int32 offset, int32 size, int headerSize, int maxBlocks) {
+	// Decompresses up to maxBlocks of the blocks covering the given range
+	// into the shared block cache, so a later decompressSampleByCurIndex()
+	// call for that range does not have to. Returns -1 if the cache does
+	// not take blocks.
+	if (!_file->isOpen() || !_compTableLoaded || _curSampleId == -1 || size <= 0)
+		return 0;
+
+	int firstBlock = (offset + headerSize) / 0x2000;
+	int lastBlock = (offset + headerSize + size - 1) / 0x2000;
+	if (lastBlock >= _numCompItems)
+		lastBlock = _numCompItems - 1;
+
+	int decoded = 0;
+	for (int i = firstBlock; i <= lastBlock && decoded < maxBlocks; i++) {
+		if (_cache->hasBlock(_slot, _curSampleId, i))
+			continue;
+
+		if (!decompressBlock(_curSampleId, i))
+			return -1;
+		decoded++;
+	}
+
+	return decoded;
+}
+
 int32 BundleMgr::decompressSampleByName(const char *name, int32 offset, int32 size, byte **comp_final, bool header_outside) {
 	int32 final_size = 0;
 
@@ -25,6 +25,7 @@
 
 #include "common/scummsys.h"
 #include "common/file.h"
+#include "common/hashmap.h"
 
 namespace Scumm {
 
@@ -53,7 +54,46 @@ private:
 		IndexNode *indexTable;
 	} _budleDirCache[4];
 
+	// Decompressed bundle blocks, shared by all BundleMgr instances and
+	// evicted least recently used first once _blockCacheSize is exceeded.
+	struct BlockKey {
+		int slot;
+		int32 index;
+		int32 block;
+	};
+
+	struct BlockKey_Hash {
+		uint operator()(const BlockKey &key) const {
+			return (uint)(key.slot << 30) ^ (uint)(key.index << 14) ^ (uint)key.block;
+		}
+	};
+
+	struct BlockKey_EqualTo {
+		bool operator()(const BlockKey &a, const BlockKey &b) const {
+			return a.slot == b.slot && a.index == b.index && a.block == b.block;
+		}
+	};
+
+	struct CachedBlock {
+		byte *data;
+		int32 size;
+		uint32 lastUse;
+	};
+
+	typedef Common::HashMap<BlockKey, CachedBlock, BlockKey_Hash, BlockKey_EqualTo> BlockMap;
+
+	BlockMap _blocks;
+	uint32 _blockCacheSize;
+	uint32 _blockCacheUsed;
+	uint32 _blockCacheTick;
+
+	void evictBlocks(uint32 needed);
+
 public:
+	enum {
+		kDefaultBlockCacheSize = 1024 * 1024
+	};
+
 	BundleDirCache();
 	~BundleDirCache();
 
@@ -62,6 +102,11 @@ public:
 	IndexNode *getIndexTable(int slot);
 	int32 getNumFiles(int slot);
 	bool isSndDataExtComp(int slot);
+
+	void setBlockCacheSize(uint32 size);
+	const byte *getBlock(int slot, int32 index, int32 block, int32 &size);
+	bool hasBlock(int slot, int32 index, int32 block) const;
+	bool storeBlock(int slot, int32 index, int32 block, const byte *data, int32 size);
 };
 
 class BundleMgr {
@@ -79,6 +124,7 @@ private:
 	BundleDirCache::IndexNode *_indexTable;
 	CompTable *_compTable;
 
+	int _slot;
 	int _numFiles;
 	int _numCompItems;
 	int _curSampleId;
@@ -91,6 +137,8 @@ private:
 	int _lastBlock;
 
 	bool loadCompTable(int32 index);
+	const byte *getBlock(int32 index, int32 block, int32 &outputSize);
+	bool decompressBlock(int32 index, int32 block);
 
 public:
 
@@ -103,6 +151,7 @@ public:
 	int32 decompressSampleByName(const char *name, int32 offset, int32 size, byte **compFinal, bool headerOutside);
 	int32 decompressSampleByIndex(int32 index, int32 offset, int32 size, byte **compFinal, int header_size, bool headerOutside);
 	int32 decompressSampleByCurIndex(int32 offset, int32 size, byte **compFinal, int headerSize, bool headerOutside);
+	int prefetchByCurIndex(int32 offset, int32 size, int headerSize, int maxBlocks);
 };
 
 } // End of namespace Scumm
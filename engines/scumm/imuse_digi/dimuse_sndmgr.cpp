@@ -22,6 +22,7 @@
 
 
 #include "common/scummsys.h"
+#include "common/config-manager.h"
 #include "common/util.h"
 
 #include "audio/decoders/flac.h"
@@ -47,6 +48,8 @@ ImuseDigiSndMgr::ImuseDigiSndMgr(ScummEngine *scumm) {
 	_disk = 0;
 	_cacheBundleDir = new BundleDirCache();
 	assert(_cacheBundleDir);
+	if (ConfMan.hasKey("imuse_bundle_cache_kb"))
+		_cacheBundleDir->setBlockCacheSize(MAX(0, ConfMan.getInt("imuse_bundle_cache_kb")) * 1024);
 	BundleCodecs::initializeImcTables();
 }
 
@@ -739,4 +742,24 @@ int32 ImuseDigiSndMgr::getDataFromRegion(SoundDesc *soundDesc, int region, byte
 	return size;
 }
 
+int ImuseDigiSndMgr::prefetchDataFromRegion(SoundDesc *soundDesc, int region, int32 offset, int32 size, int maxBlocks) {
+	assert(checkForProperHandle(soundDesc));
+	assert(region >= 0 && region < soundDesc->numRegions);
+
+	// Only uncompressed bundles go through the block cache
+	if (!soundDesc->bundle || soundDesc->compressed)
+		return 0;
+
+	int32 region_length = soundDesc->region[region].length;
+	int32 offset_data = soundDesc->offsetData;
+	int32 start = soundDesc->region[region].offset - offset_data;
+
+	if (offset + size + offset_data > region_length)
+		size = region_length - offset;
+	if (size <= 0)
+		return 0;
+
+	return soundDesc->bundle->prefetchByCurIndex(start + offset, size, offset_data, maxBlocks);
+}
+
 } // End of namespace Scumm
@@ -831,6 +831,9 @@ byte *ResourceManager::createResource(ResType type, ResId idx, uint32 size) {
 	memset(ptr, 0, size + SAFETY_AREA);
 	_allocatedSize += size;
 
+	if (type == rtMatrix)
+		_vm->invalidateBoxCache();
+
 	_types[type][idx]._address = ptr;
 	_types[type][idx]._size = size;
 	setResourceCounter(type, idx, 1);
@@ -899,6 +902,9 @@ void ResourceManager::nukeResource(ResType type, ResId idx) {
 		debugC(DEBUG_RESOURCE, "nukeResource(%s,%d)", nameOfResType(type), idx);
 		_allocatedSize -= _types[type][idx]._size;
 		_types[type][idx].nuke();
+
+		if (type == rtMatrix)
+			_vm->invalidateBoxCache();
 	}
 }
 
@@ -303,6 +303,10 @@ ScummEngine::ScummEngine(OSystem *syst, const DetectorResult &dr)
 	_defaultTalkDelay = 0;
 	_saveSound = 0;
 	memset(_extraBoxFlags, 0, sizeof(_extraBoxFlags));
+	_boxCacheValid = false;
+	_boxGridLeft = _boxGridTop = 0;
+	_boxGridColumns = _boxGridRows = 0;
+	_boxGridCellSize = 0;
 	memset(_scaleSlots, 0, sizeof(_scaleSlots));
 	_charset = NULL;
 	_charsetColor = 0;
@@ -2110,9 +2114,21 @@ void ScummEngine::waitForTimer(int msec_delay) {
 #endif
 
 		_system->updateScreen();
-		if (_system->getMillis() >= start_time + msec_delay)
+
+#ifdef ENABLE_SCUMM_7_8
+		// Use the time until the next frame is due to decompress the audio
+		// the digital iMUSE callback is going to need next.
+		if (_imuseDigital)
+			_imuseDigital->prefetch();
+#endif
+
+		const uint32 curTime = _system->getMillis();
+		if (curTime >= start_time + msec_delay)
 			break;
-		_system->delayMillis(10);
+
+		// Sleep until the next frame is due, but wake up as soon as the
+		// user does something, so input is handled without delay.
+		_system->waitForEvent(start_time + msec_delay - curTime);
 	}
 }
 
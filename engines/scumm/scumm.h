@@ -25,6 +25,7 @@
 
 #include "engines/engine.h"
 
+#include "common/array.h"
 #include "common/endian.h"
 #include "common/events.h"
 #include "common/file.h"
@@ -38,6 +39,7 @@
 #include "graphics/surface.h"
 #include "graphics/sjis.h"
 
+#include "scumm/boxes.h"
 #include "scumm/gfx.h"
 #include "scumm/detection.h"
 #include "scumm/script.h"
@@ -748,9 +750,9 @@ protected:
 //	void nukeResource(ResType type, ResId idx);
 	int getResourceRoomNr(ResType type, ResId idx);
 	virtual uint32 getResourceRoomOffset(ResType type, ResId idx);
-	int getResourceSize(ResType type, ResId idx);
 
 public:
+	int getResourceSize(ResType type, ResId idx);
 	byte *getResourceAddress(ResType type, ResId idx);
 	virtual byte *getStringAddress(ResId idx);
 	byte *getStringAddressVar(int i);
@@ -1138,6 +1140,16 @@ public:
 	bool checkXYInBoxBounds(int box, int x, int y);
 
 	BoxCoords getBoxCoordinates(int boxnum);
+	int getClosestPtOnBox(int boxnum, int x, int y, int16 &outX, int16 &outY);
+
+	enum {
+		// Largest distance from a box at which getBoxesNearPoint() still
+		// reports it.
+		kBoxGridMargin = 80
+	};
+
+	const byte *getBoxesNearPoint(int x, int y, int &numBoxes);
+	void invalidateBoxCache() { _boxCacheValid = false; }
 
 	byte getMaskFromBox(int box);
 	Box *getBoxBaseAddr(int box);
@@ -1148,6 +1160,35 @@ public:
 	int getScaleFromSlot(int slot, int x, int y);
 
 protected:
+	// Decoded box coordinates of the current room, rebuilt whenever one of
+	// the box resources changes. Each entry also remembers its last
+	// getClosestPtOnBox() query.
+	struct BoxCacheEntry {
+		BoxCoords coords;
+		int closestQueryX, closestQueryY;
+		int16 closestX, closestY;
+		int closestDist;
+		bool closestValid;
+	};
+
+	enum {
+		kBoxGridMaxCells = 4096
+	};
+
+	Common::Array<BoxCacheEntry> _boxCache;
+	bool _boxCacheValid;
+
+	// Grid of square cells over all boxes, listing for every cell the boxes
+	// whose bounds grown by kBoxGridMargin overlap it.
+	int _boxGridLeft, _boxGridTop;
+	int _boxGridColumns, _boxGridRows;
+	int _boxGridCellSize;
+	Common::Array<uint32> _boxGridStart;
+	Common::Array<byte> _boxGridBoxes;
+
+	void buildBoxCache();
+	BoxCoords readBoxCoordinates(int boxnum);
+
 	// Scaling slots/items
 	struct ScaleSlot {
 		int x1, y1, scale1;
@@ -325,6 +325,17 @@ void Codec37Decoder::maketable(int pitch, int index) {
 		dst += 4;						  \
 	} while (0)
 
+/* Copy a run of 4x4 pixel blocks in one block row from the same offset */
+
+#define COPY_4X4_RUN(dst, offs, pitch, n)				  \
+	do {								  \
+		int x;							  \
+		for (x=0; x<4; x++) {					  \
+			memcpy(dst + pitch * x, dst + offs + pitch * x, (n) * 4); \
+		}							  \
+		dst += (n) * 4;						  \
+	} while (0)
+
 void Codec37Decoder::proc1(byte *dst, const byte *src, int32 next_offs, int bw, int bh, int pitch, int16 *offset_table) {
 	uint8 code;
 	bool filling, skipCode;
@@ -439,10 +450,11 @@ void Codec37Decoder::proc4WithFDFE(byte *dst, const byte *src, int32 next_offs,
 				LITERAL_1X1(src, dst, pitch);
 			} else if (code == 0x00) {
 				int32 length = *src++ + 1;
-				for (int32 l = 0; l < length; l++) {
-					byte *dst2 = dst + next_offs;
-					COPY_4X4(dst2, dst, pitch);
-					i--;
+				while (length > 0) {
+					int32 n = MIN(length, i);
+					COPY_4X4_RUN(dst, next_offs, pitch, n);
+					length -= n;
+					i -= n;
 					if (i == 0) {
 						dst += pitch * 3;
 						bh--;
@@ -471,10 +483,11 @@ void Codec37Decoder::proc4WithoutFDFE(byte *dst, const byte *src, int32 next_off
 				LITERAL_1X1(src, dst, pitch);
 			} else if (code == 0x00) {
 				int32 length = *src++ + 1;
-				for (int32 l = 0; l < length; l++) {
-					byte *dst2 = dst + next_offs;
-					COPY_4X4(dst2, dst, pitch);
-					i--;
+				while (length > 0) {
+					int32 n = MIN(length, i);
+					COPY_4X4_RUN(dst, next_offs, pitch, n);
+					length -= n;
+					i -= n;
 					if (i == 0) {
 						dst += pitch * 3;
 						bh--;
@@ -45,24 +45,47 @@ namespace Scumm {
 		(dst)[1] = (src)[1];	\
 	} while (0)
 
+#define COPY_8X1_LINE(dst, src)			\
+	do {					\
+		COPY_4X1_LINE(dst, src);	\
+		COPY_4X1_LINE((dst) + 4, (src) + 4);	\
+	} while (0)
+
+#define FILL_4X1_LINE(dst, val)			\
+	do {					\
+		(dst)[0] = val;	\
+		(dst)[1] = val;	\
+		(dst)[2] = val;	\
+		(dst)[3] = val;	\
+	} while (0)
+
+#define FILL_8X1_LINE(dst, val)			\
+	do {					\
+		FILL_4X1_LINE(dst, val);	\
+		FILL_4X1_LINE((dst) + 4, val);	\
+	} while (0)
 
 #else /* SCUMM_NEED_ALIGNMENT */
 
+// Whole block lines are moved as single machine words. The pixel value
+// is replicated into every byte of the word for fills.
+
 #define COPY_4X1_LINE(dst, src)			\
 	*(uint32 *)(dst) = *(const uint32 *)(src)
 
 #define COPY_2X1_LINE(dst, src)			\
 	*(uint16 *)(dst) = *(const uint16 *)(src)
 
-#endif
+#define COPY_8X1_LINE(dst, src)			\
+	*(uint64 *)(dst) = *(const uint64 *)(src)
 
 #define FILL_4X1_LINE(dst, val)			\
-	do {					\
-		(dst)[0] = val;	\
-		(dst)[1] = val;	\
-		(dst)[2] = val;	\
-		(dst)[3] = val;	\
-	} while (0)
+	*(uint32 *)(dst) = (uint32)(val) * 0x01010101U
+
+#define FILL_8X1_LINE(dst, val)			\
+	*(uint64 *)(dst) = ((uint64)((uint32)(val) * 0x01010101U) << 32) | ((uint32)(val) * 0x01010101U)
+
+#endif
 
 #define FILL_2X1_LINE(dst, val)			\
 	do {					\
@@ -451,8 +474,7 @@ void Codec47Decoder::level1(byte *d_dst) {
 	if (code < 0xF8) {
 		tmp2 = _table[code] + _offset1;
 		for (i = 0; i < 8; i++) {
-			COPY_4X1_LINE(d_dst + 0, d_dst + tmp2);
-			COPY_4X1_LINE(d_dst + 4, d_dst + tmp2 + 4);
+			COPY_8X1_LINE(d_dst, d_dst + tmp2);
 			d_dst += _d_pitch;
 		}
 	} else if (code == 0xFF) {
@@ -466,8 +488,7 @@ void Codec47Decoder::level1(byte *d_dst) {
 	} else if (code == 0xFE) {
 		byte t = *_d_src++;
 		for (i = 0; i < 8; i++) {
-			FILL_4X1_LINE(d_dst, t);
-			FILL_4X1_LINE(d_dst + 4, t);
+			FILL_8X1_LINE(d_dst, t);
 			d_dst += _d_pitch;
 		}
 	} else if (code == 0xFD) {
@@ -490,15 +511,13 @@ void Codec47Decoder::level1(byte *d_dst) {
 	} else if (code == 0xFC) {
 		tmp2 = _offset2;
 		for (i = 0; i < 8; i++) {
-			COPY_4X1_LINE(d_dst + 0, d_dst + tmp2);
-			COPY_4X1_LINE(d_dst + 4, d_dst + tmp2 + 4);
+			COPY_8X1_LINE(d_dst, d_dst + tmp2);
 			d_dst += _d_pitch;
 		}
 	} else {
 		byte t = _paramPtr[code];
 		for (i = 0; i < 8; i++) {
-			FILL_4X1_LINE(d_dst, t);
-			FILL_4X1_LINE(d_dst + 4, t);
+			FILL_8X1_LINE(d_dst, t);
 			d_dst += _d_pitch;
 		}
 	}
@@ -24,6 +24,7 @@
 
 #include "common/config-manager.h"
 #include "common/file.h"
+#include "common/memstream.h"
 #include "common/system.h"
 #include "common/util.h"
 
@@ -220,6 +221,8 @@ SmushPlayer::SmushPlayer(ScummEngine_v7 *scumm) {
 	_sf[3] = NULL;
 	_sf[4] = NULL;
 	_base = NULL;
+	_nextFrame = NULL;
+	_nextFrameSize = 0;
 	_frameBuffer = NULL;
 	_specialBuffer = NULL;
 
@@ -287,6 +290,9 @@ void SmushPlayer::release() {
 	delete _strings;
 	_strings = NULL;
 
+	delete _nextFrame;
+	_nextFrame = NULL;
+
 	delete _base;
 	_base = NULL;
 
@@ -966,12 +972,45 @@ SmushFont *SmushPlayer::getFont(int font) {
 	return _sf[font];
 }
 
+void SmushPlayer::readAheadFrame() {
+	// Read the next frame chunk into memory while the current frame is
+	// on screen, so parseNextFrame() does not have to wait for the file.
+	// Decoding itself stays in parseNextFrame(), since every frame
+	// depends on the state left behind by the previous one.
+	if (_nextFrame || !_base || _seekPos >= 0 || _endOfFile)
+		return;
+
+	const int32 chunkOffset = _base->pos();
+	const uint32 subType = _base->readUint32BE();
+	const int32 subSize = _base->readUint32BE();
+
+	if (_base->pos() >= (int32)_baseSize || subType != MKTAG('F','R','M','E') || subSize < 0) {
+		_base->seek(chunkOffset, SEEK_SET);
+		return;
+	}
+
+	// One spare byte, in case the last sub chunk is padded beyond the frame
+	byte *buffer = (byte *)malloc(subSize + 1);
+	if (!buffer || _base->read(buffer, subSize) != (uint32)subSize) {
+		free(buffer);
+		_base->seek(chunkOffset, SEEK_SET);
+		return;
+	}
+	buffer[subSize] = 0;
+
+	_nextFrame = new Common::MemoryReadStream(buffer, subSize + 1, DisposeAfterUse::YES);
+	_nextFrameSize = subSize;
+}
+
 void SmushPlayer::parseNextFrame() {
 
 	if (_seekPos >= 0) {
 		if (_smixer)
 			_smixer->stop();
 
+		delete _nextFrame;
+		_nextFrame = NULL;
+
 		if (_seekFile.size() > 0) {
 			delete _base;
 
@@ -1014,30 +1053,38 @@ void SmushPlayer::parseNextFrame() {
 
 	assert(_base);
 
-	const uint32 subType = _base->readUint32BE();
-	const int32 subSize = _base->readUint32BE();
-	const int32 subOffset = _base->pos();
+	if (_nextFrame) {
+		Common::SeekableReadStream *frame = _nextFrame;
+		_nextFrame = NULL;
 
-	if (_base->pos() >= (int32)_baseSize) {
-		_vm->_smushVideoShouldFinish = true;
-		_endOfFile = true;
-		return;
-	}
+		handleFrame(_nextFrameSize, *frame);
+		delete frame;
+	} else {
+		const uint32 subType = _base->readUint32BE();
+		const int32 subSize = _base->readUint32BE();
+		const int32 subOffset = _base->pos();
 
-	debug(3, "Chunk: %s at %x", tag2str(subType), subOffset);
+		if (_base->pos() >= (int32)_baseSize) {
+			_vm->_smushVideoShouldFinish = true;
+			_endOfFile = true;
+			return;
+		}
 
-	switch (subType) {
-	case MKTAG('A','H','D','R'): // FT INSANE may seek file to the beginning
-		handleAnimHeader(subSize, *_base);
-		break;
-	case MKTAG('F','R','M','E'):
-		handleFrame(subSize, *_base);
-		break;
-	default:
-		error("Unknown Chunk found at %x: %s, %d", subOffset, tag2str(subType), subSize);
-	}
+		debug(3, "Chunk: %s at %x", tag2str(subType), subOffset);
+
+		switch (subType) {
+		case MKTAG('A','H','D','R'): // FT INSANE may seek file to the beginning
+			handleAnimHeader(subSize, *_base);
+			break;
+		case MKTAG('F','R','M','E'):
+			handleFrame(subSize, *_base);
+			break;
+		default:
+			error("Unknown Chunk found at %x: %s, %d", subOffset, tag2str(subType), subSize);
+		}
 
-	_base->seek(subOffset + subSize, SEEK_SET);
+		_base->seek(subOffset + subSize, SEEK_SET);
+	}
 
 	if (_insanity)
 		_vm->_sound->processSound();
@@ -1249,6 +1296,7 @@ void SmushPlayer::play(const char *filename, int32 speed, int32 offset, int32 st
 			_IACTpos = 0;
 			break;
 		}
+		readAheadFrame();
 		_vm->_system->delayMillis(10);
 	}
 
@@ -49,6 +49,8 @@ private:
 	Codec47Decoder *_codec47;
 	Common::SeekableReadStream *_base;
 	uint32 _baseSize;
+	Common::SeekableReadStream *_nextFrame;
+	int32 _nextFrameSize;
 	byte *_frameBuffer;
 	byte *_specialBuffer;
 
@@ -111,6 +113,7 @@ protected:
 private:
 	SmushFont *getFont(int font);
 	void parseNextFrame();
+	void readAheadFrame();
 	void init(int32 spped);
 	void setupAnim(const char *file);
 	void updateScreen();
@@ -34,6 +34,9 @@ RenderTable::RenderTable(uint numColumns, uint numRows)
 	assert(numRows != 0 && numColumns != 0);
 
 	_internalBuffer = new Common::Point[numRows * numColumns];
+	_sourceIndexBuffer = new uint32[numRows * numColumns];
+	for (uint32 i = 0; i < numRows * numColumns; ++i)
+		_sourceIndexBuffer[i] = i;
 
 	memset(&_panoramaOptions, 0, sizeof(_panoramaOptions));
 	memset(&_tiltOptions, 0, sizeof(_tiltOptions));
@@ -41,6 +44,7 @@ RenderTable::RenderTable(uint numColumns, uint numRows)
 
 RenderTable::~RenderTable() {
 	delete[] _internalBuffer;
+	delete[] _sourceIndexBuffer;
 }
 
 void RenderTable::setRenderState(RenderState newState) {
@@ -82,45 +86,31 @@ const Common::Point RenderTable::convertWarpedCoordToFlatCoord(const Common::Poi
 }
 
 void RenderTable::mutateImage(uint16 *sourceBuffer, uint16 *destBuffer, uint32 destWidth, const Common::Rect &subRect) {
-	uint32 destOffset = 0;
+	const uint32 width = subRect.width();
 
 	for (int16 y = subRect.top; y < subRect.bottom; ++y) {
-		uint32 sourceOffset = y * _numColumns;
+		const uint32 *sourceIndex = _sourceIndexBuffer + y * _numColumns + subRect.left;
 
-		for (int16 x = subRect.left; x < subRect.right; ++x) {
-			uint32 normalizedX = x - subRect.left;
-			uint32 index = sourceOffset + x;
+		// A plain gather, which the compiler can vectorize
+		for (uint32 x = 0; x < width; ++x)
+			destBuffer[x] = sourceBuffer[sourceIndex[x]];
 
-			// RenderTable only stores offsets from the original coordinates
-			uint32 sourceYIndex = y + _internalBuffer[index].y;
-			uint32 sourceXIndex = x + _internalBuffer[index].x;
-
-			destBuffer[destOffset + normalizedX] = sourceBuffer[sourceYIndex * _numColumns + sourceXIndex];
-		}
-
-		destOffset += destWidth;
+		destBuffer += destWidth;
 	}
 }
 
 void RenderTable::mutateImage(Graphics::Surface *dstBuf, Graphics::Surface *srcBuf) {
-	uint32 destOffset = 0;
-
-	uint16 *sourceBuffer = (uint16 *)srcBuf->getPixels();
+	const uint16 *sourceBuffer = (const uint16 *)srcBuf->getPixels();
 	uint16 *destBuffer = (uint16 *)dstBuf->getPixels();
+	const uint32 width = srcBuf->w;
 
 	for (int16 y = 0; y < srcBuf->h; ++y) {
-		uint32 sourceOffset = y * _numColumns;
+		const uint32 *sourceIndex = _sourceIndexBuffer + y * _numColumns;
 
-		for (int16 x = 0; x < srcBuf->w; ++x) {
-			uint32 index = sourceOffset + x;
+		for (uint32 x = 0; x < width; ++x)
+			destBuffer[x] = sourceBuffer[sourceIndex[x]];
 
-			// RenderTable only stores offsets from the original coordinates
-			uint32 sourceYIndex = y + _internalBuffer[index].y;
-			uint32 sourceXIndex = x + _internalBuffer[index].x;
-
-			destBuffer[destOffset] = sourceBuffer[sourceYIndex * _numColumns + sourceXIndex];
-			destOffset++;
-		}
+		destBuffer += width;
 	}
 }
 
@@ -139,8 +129,6 @@ void RenderTable::generateRenderTable() {
 }
 
 void RenderTable::generatePanoramaLookupTable() {
-	memset(_internalBuffer, 0, _numRows * _numColumns * sizeof(uint16));
-
 	float halfWidth = (float)_numColumns / 2.0f;
 	float halfHeight = (float)_numRows / 2.0f;
 
@@ -168,6 +156,7 @@ void RenderTable::generatePanoramaLookupTable() {
 			// Only store the (x,y) offsets instead of the absolute positions
 			_internalBuffer[index].x = xInCylinderCoords - x;
 			_internalBuffer[index].y = yInCylinderCoords - y;
+			_sourceIndexBuffer[index] = yInCylinderCoords * _numColumns + xInCylinderCoords;
 		}
 	}
 }
@@ -203,6 +192,7 @@ void RenderTable::generateTiltLookupTable() {
 			// Only store the (x,y) offsets instead of the absolute positions
 			_internalBuffer[index].x = xInCylinderCoords - x;
 			_internalBuffer[index].y = yInCylinderCoords - y;
+			_sourceIndexBuffer[index] = yInCylinderCoords * _numColumns + xInCylinderCoords;
 		}
 	}
 }
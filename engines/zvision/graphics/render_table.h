@@ -43,6 +43,9 @@ public:
 private:
 	uint _numColumns, _numRows;
 	Common::Point *_internalBuffer;
+	// Index of the source pixel for each destination pixel, so that warping
+	// an image doesn't have to compute it for every pixel of every frame
+	uint32 *_sourceIndexBuffer;
 	RenderState _renderState;
 
 	struct {
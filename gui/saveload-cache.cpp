@@ -0,0 +1,119 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#include "gui/saveload-cache.h"
+
+#include "common/algorithm.h"
+#include "common/savefile.h"
+#include "common/system.h"
+
+namespace Common {
+DECLARE_SINGLETON(GUI::SaveLoadCache);
+}
+
+namespace GUI {
+
+SaveStateList SaveLoadCache::listSaves(const MetaEngine *metaEngine, const Common::String &target) {
+	StampList stamps;
+	if (!collectStamps(metaEngine, target, stamps)) {
+		invalidate(target);
+		return metaEngine->listSaves(target.c_str());
+	}
+
+	SaveListMap::iterator i = _saveLists.find(target);
+	if (i == _saveLists.end() || !(i->_value.stamps == stamps)) {
+		invalidate(target);
+
+		SaveListEntry entry;
+		entry.stamps = stamps;
+		entry.saveList = metaEngine->listSaves(target.c_str());
+		_saveLists[target] = entry;
+		i = _saveLists.find(target);
+	}
+
+	if (_metaInfoTarget != target) {
+		_metaInfoTarget = target;
+		_metaInfos.clear();
+	}
+
+	return i->_value.saveList;
+}
+
+SaveStateDescriptor SaveLoadCache::querySaveMetaInfos(const MetaEngine *metaEngine, const Common::String &target, int slot) {
+	if (_metaInfoTarget != target || !_saveLists.contains(target))
+		return metaEngine->querySaveMetaInfos(target.c_str(), slot);
+
+	MetaInfoMap::const_iterator i = _metaInfos.find(slot);
+	if (i != _metaInfos.end())
+		return i->_value;
+
+	// SaveStateDescriptor shares its thumbnail, so keeping a copy here is
+	// cheap and the thumbnail is only decoded once.
+	SaveStateDescriptor desc = metaEngine->querySaveMetaInfos(target.c_str(), slot);
+	_metaInfos[slot] = desc;
+	return desc;
+}
+
+void SaveLoadCache::invalidate(const Common::String &target) {
+	_saveLists.erase(target);
+
+	if (_metaInfoTarget == target) {
+		_metaInfoTarget.clear();
+		_metaInfos.clear();
+	}
+}
+
+namespace {
+struct FileStampLess {
+	template<class T>
+	bool operator()(const T &l, const T &r) const {
+		return l.name < r.name;
+	}
+};
+} // End of anonymous namespace
+
+bool SaveLoadCache::collectStamps(const MetaEngine *metaEngine, const Common::String &target, StampList &stamps) const {
+	// Without the pattern of the engine, there is no telling which files
+	// its saves consist of, and when they change.
+	const Common::String pattern = metaEngine->getSavegameFilePattern(target.c_str());
+	if (pattern.empty())
+		return false;
+
+	Common::SaveFileManager *saveFileMan = g_system->getSavefileManager();
+	const Common::StringArray files = saveFileMan->listSavefiles(pattern);
+
+	stamps.clear();
+	stamps.reserve(files.size());
+	for (Common::StringArray::const_iterator i = files.begin(); i != files.end(); ++i) {
+		FileStamp stamp;
+		stamp.name = *i;
+		if (!saveFileMan->getSavefileInfo(stamp.name, stamp.size, stamp.modifiedTime))
+			return false;
+		stamps.push_back(stamp);
+	}
+
+	// The order of the files returned by listSavefiles is not specified.
+	Common::sort(stamps.begin(), stamps.end(), FileStampLess());
+	return true;
+}
+
+} // End of namespace GUI
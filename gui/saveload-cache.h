@@ -0,0 +1,124 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#ifndef GUI_SAVELOAD_CACHE_H
+#define GUI_SAVELOAD_CACHE_H
+
+#include "common/array.h"
+#include "common/hashmap.h"
+#include "common/singleton.h"
+#include "common/str.h"
+
+#include "engines/metaengine.h"
+
+namespace GUI {
+
+/**
+ * Caches the save state lists and the meta infos (including the decoded
+ * thumbnails) of saves.
+ *
+ * Querying the meta infos of a save usually means opening the save file,
+ * parsing its header and decoding the thumbnail. Doing this for every
+ * save, every time a save/load dialog is opened or a page of the grid
+ * chooser is shown, adds up quickly for targets with many saves.
+ *
+ * Only targets whose engine reports its savefile pattern through
+ * MetaEngine::getSavegameFilePattern are cached. The cache of a target is
+ * validated against the sizes and modification times of all savefiles
+ * matching that pattern. If any of them changed, or any was added or
+ * removed, everything cached for the target is dropped. When the savefile
+ * manager cannot provide this information, nothing is cached and all
+ * queries are passed through to the engine.
+ *
+ * The save state lists are kept for all targets, so switching between
+ * them does not require the engine to open every save again. The meta
+ * infos are only kept for the most recently used target, to bound memory
+ * usage. Nothing is kept across restarts.
+ */
+class SaveLoadCache : public Common::Singleton<SaveLoadCache> {
+public:
+	/**
+	 * Return the save state list of the given target, like
+	 * MetaEngine::listSaves does. This also revalidates the cache.
+	 */
+	SaveStateList listSaves(const MetaEngine *metaEngine, const Common::String &target);
+
+	/**
+	 * Return the meta infos of the given save slot, like
+	 * MetaEngine::querySaveMetaInfos does. The cache is assumed to have
+	 * been validated by a preceding call to listSaves().
+	 */
+	SaveStateDescriptor querySaveMetaInfos(const MetaEngine *metaEngine, const Common::String &target, int slot);
+
+	/**
+	 * Drop everything cached for the given target. Has to be called after
+	 * the saves of the target were changed by the caller.
+	 */
+	void invalidate(const Common::String &target);
+
+private:
+	friend class Common::Singleton<SingletonBaseType>;
+	SaveLoadCache() {}
+
+	struct FileStamp {
+		Common::String name;
+		uint32 size;
+		uint32 modifiedTime;
+
+		bool operator==(const FileStamp &other) const {
+			return name == other.name && size == other.size && modifiedTime == other.modifiedTime;
+		}
+
+		bool operator!=(const FileStamp &other) const {
+			return !(*this == other);
+		}
+	};
+	typedef Common::Array<FileStamp> StampList;
+
+	/**
+	 * Collect the stamps of all savefiles belonging to the given target.
+	 *
+	 * @return false if the savefiles cannot be stamped, i.e. nothing
+	 *         may be cached for the target.
+	 */
+	bool collectStamps(const MetaEngine *metaEngine, const Common::String &target, StampList &stamps) const;
+
+	struct SaveListEntry {
+		StampList stamps;
+		SaveStateList saveList;
+	};
+	typedef Common::HashMap<Common::String, SaveListEntry> SaveListMap;
+	typedef Common::HashMap<int, SaveStateDescriptor> MetaInfoMap;
+
+	SaveListMap _saveLists;
+
+	/** The target the meta infos belong to. */
+	Common::String _metaInfoTarget;
+	MetaInfoMap _metaInfos;
+};
+
+} // End of namespace GUI
+
+/** Shortcut for accessing the save/load cache. */
+#define SaveLoadCacheMan (::GUI::SaveLoadCache::instance())
+
+#endif
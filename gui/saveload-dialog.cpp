@@ -21,6 +21,7 @@
  */
 
 #include "gui/saveload-dialog.h"
+#include "gui/saveload-cache.h"
 #include "common/translation.h"
 #include "common/config-manager.h"
 
@@ -276,6 +277,7 @@ void SaveLoadChooserSimple::handleCommand(CommandSender *sender, uint32 cmd, uin
 								_("Delete"), _("Cancel"));
 			if (alert.runModal() == kMessageOK) {
 				_metaEngine->removeSaveState(_target.c_str(), _saveList[selItem].getSaveSlot());
+				SaveLoadCacheMan.invalidate(_target);
 
 				setResult(-1);
 				_list->setSelected(-1);
@@ -362,7 +364,7 @@ void SaveLoadChooserSimple::updateSelection(bool redraw) {
 	_playtime->setLabel(_("No playtime saved"));
 
 	if (selItem >= 0 && _metaInfoSupport) {
-		SaveStateDescriptor desc = _metaEngine->querySaveMetaInfos(_target.c_str(), _saveList[selItem].getSaveSlot());
+		SaveStateDescriptor desc = SaveLoadCacheMan.querySaveMetaInfos(_metaEngine, _target, _saveList[selItem].getSaveSlot());
 
 		isDeletable = desc.getDeletableFlag() && _delSupport;
 		isWriteProtected = desc.getWriteProtectedFlag();
@@ -463,7 +465,7 @@ void SaveLoadChooserSimple::close() {
 }
 
 void SaveLoadChooserSimple::updateSaveList() {
-	_saveList = _metaEngine->listSaves(_target.c_str());
+	_saveList = SaveLoadCacheMan.listSaves(_metaEngine, _target);
 
 	int curSlot = 0;
 	int saveSlot = 0;
@@ -622,7 +624,7 @@ void SaveLoadChooserGrid::handleMouseWheel(int x, int y, int direction) {
 void SaveLoadChooserGrid::open() {
 	SaveLoadChooserDialog::open();
 
-	_saveList = _metaEngine->listSaves(_target.c_str());
+	_saveList = SaveLoadCacheMan.listSaves(_metaEngine, _target);
 	_resultString.clear();
 
 	// Load information to restore the last page the user had open.
@@ -655,7 +657,7 @@ void SaveLoadChooserGrid::open() {
 			// In case there was a gap found use the slot.
 			if (lastSlot + 1 < curSlot) {
 				// Check that the save slot can be used for user saves.
-				SaveStateDescriptor desc = _metaEngine->querySaveMetaInfos(_target.c_str(), lastSlot + 1);
+				SaveStateDescriptor desc = SaveLoadCacheMan.querySaveMetaInfos(_metaEngine, _target, lastSlot + 1);
 				if (!desc.getWriteProtectedFlag()) {
 					_nextFreeSaveSlot = lastSlot + 1;
 					break;
@@ -669,7 +671,7 @@ void SaveLoadChooserGrid::open() {
 		const int maxSlot = _metaEngine->getMaximumSaveSlot();
 		for (int i = lastSlot; _nextFreeSaveSlot == -1 && i < maxSlot; ++i) {
 			// Check that the save slot can be used for user saves.
-			SaveStateDescriptor desc = _metaEngine->querySaveMetaInfos(_target.c_str(), i + 1);
+			SaveStateDescriptor desc = SaveLoadCacheMan.querySaveMetaInfos(_metaEngine, _target, i + 1);
 			if (!desc.getWriteProtectedFlag()) {
 				_nextFreeSaveSlot = i + 1;
 			}
@@ -863,7 +865,7 @@ void SaveLoadChooserGrid::updateSaves() {
 	for (uint i = _curPage * _entriesPerPage, curNum = 0; i < _saveList.size() && curNum < _entriesPerPage; ++i, ++curNum) {
 		const uint saveSlot = _saveList[i].getSaveSlot();
 
-		SaveStateDescriptor desc = _metaEngine->querySaveMetaInfos(_target.c_str(), saveSlot);
+		SaveStateDescriptor desc = SaveLoadCacheMan.querySaveMetaInfos(_metaEngine, _target, saveSlot);
 		SlotButton &curButton = _buttons[curNum];
 		curButton.setVisible(true);
 		const Graphics::Surface *thumbnail = desc.getThumbnail();
@@ -0,0 +1,96 @@
+#include <cxxtest/TestSuite.h>
+
+#include "audio/softsynth/opl/dbopl.h"
+
+class DBOPLTestSuite : public CxxTest::TestSuite
+{
+private:
+	uint32 _seed;
+
+	uint32 nextRandom() {
+		_seed = _seed * 1103515245 + 12345;
+		return (_seed >> 16) & 0x7FFF;
+	}
+
+	// Writes random operator and channel setups and random key on/off events
+	void writeRandomRegisters(OPL::DOSBox::DBOPL::Chip &a, OPL::DOSBox::DBOPL::Chip &b, bool opl3) {
+		static const uint8 bases[] = { 0x20, 0x40, 0x60, 0x80, 0xE0, 0xA0, 0xB0, 0xC0 };
+
+		for (int i = 0; i < 16; ++i) {
+			uint32 reg = bases[nextRandom() % ARRAYSIZE(bases)];
+			if (reg >= 0xA0 && reg < 0xE0)
+				reg += nextRandom() % 9;
+			else
+				reg += nextRandom() % 0x16;
+			if (opl3 && (nextRandom() & 1))
+				reg += 0x100;
+
+			const uint8 val = nextRandom() & 0xFF;
+			a.WriteReg(reg, val);
+			b.WriteReg(reg, val);
+		}
+	}
+
+	void compareRenderers(bool opl3, bool fourOp) {
+		OPL::DOSBox::DBOPL::InitTables();
+
+		OPL::DOSBox::DBOPL::Chip reference;
+		OPL::DOSBox::DBOPL::Chip block;
+		reference.Setup(22050);
+		block.Setup(22050);
+		reference.referenceRender = true;
+
+		if (opl3) {
+			reference.WriteReg(0x105, 1);
+			block.WriteReg(0x105, 1);
+			if (fourOp) {
+				reference.WriteReg(0x104, 0x3F);
+				block.WriteReg(0x104, 0x3F);
+			}
+		}
+		// Waveform select
+		reference.WriteReg(0x01, 0x20);
+		block.WriteReg(0x01, 0x20);
+
+		const uint samples = 700;
+		int32 referenceOutput[samples * 2];
+		int32 blockOutput[samples * 2];
+
+		uint nonSilent = 0;
+		_seed = fourOp ? 3 : (opl3 ? 2 : 1);
+		for (int step = 0; step < 100; ++step) {
+			writeRandomRegisters(reference, block, opl3);
+
+			const uint count = 1 + nextRandom() % samples;
+			if (opl3) {
+				reference.GenerateBlock3(count, referenceOutput);
+				block.GenerateBlock3(count, blockOutput);
+			} else {
+				reference.GenerateBlock2(count, referenceOutput);
+				block.GenerateBlock2(count, blockOutput);
+			}
+
+			for (uint i = 0; i < count * (opl3 ? 2 : 1); ++i) {
+				if (referenceOutput[i])
+					++nonSilent;
+			}
+			TS_ASSERT_EQUALS(memcmp(referenceOutput, blockOutput, count * sizeof(int32) * (opl3 ? 2 : 1)), 0);
+		}
+
+		// Make sure the register writes actually produced sound
+		TS_ASSERT(nonSilent > 0);
+	}
+
+public:
+	void test_block_render_opl2() {
+		compareRenderers(false, false);
+	}
+
+	void test_block_render_opl3() {
+		compareRenderers(true, false);
+	}
+
+	void test_block_render_opl3_four_op() {
+		compareRenderers(true, true);
+	}
+};
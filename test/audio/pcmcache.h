@@ -0,0 +1,101 @@
+#include <cxxtest/TestSuite.h>
+
+#include "audio/pcmcache.h"
+#include "audio/audiostream.h"
+
+#include "helper.h"
+
+class PCMCacheTestSuite : public CxxTest::TestSuite
+{
+public:
+	void test_cached_stream_matches_source() {
+		PCMCacheMan.clear();
+
+		int16 *sine;
+		Audio::SeekableAudioStream *s = createSineStream<int16>(11025, 2, &sine, false, true);
+		const int totalSamples = 11025 * 2 * 2;
+
+		TS_ASSERT(!PCMCacheMan.getStream("sine"));
+		Audio::SeekableAudioStream *cached = PCMCacheMan.addStream("sine", s);
+		TS_ASSERT(cached != s);
+		TS_ASSERT_EQUALS(cached->isStereo(), true);
+		TS_ASSERT_EQUALS(cached->getRate(), 11025);
+		TS_ASSERT_EQUALS(cached->getLength().totalNumberOfFrames(), 11025 * 2);
+
+		int16 *buffer = new int16[totalSamples];
+		TS_ASSERT_EQUALS(cached->readBuffer(buffer, totalSamples), totalSamples);
+		TS_ASSERT_EQUALS(memcmp(sine, buffer, sizeof(int16) * totalSamples), 0);
+		TS_ASSERT_EQUALS(cached->endOfData(), true);
+		delete cached;
+
+		// The data must survive the first stream
+		Audio::SeekableAudioStream *hit = PCMCacheMan.getStream("sine");
+		TS_ASSERT(hit);
+		TS_ASSERT_EQUALS(hit->seek(Audio::Timestamp(1000, 11025)), true);
+		TS_ASSERT_EQUALS(hit->readBuffer(buffer, totalSamples), totalSamples / 2);
+		TS_ASSERT_EQUALS(memcmp(sine + totalSamples / 2, buffer, sizeof(int16) * totalSamples / 2), 0);
+		delete hit;
+
+		TS_ASSERT_EQUALS(PCMCacheMan.getHits(), (uint32)1);
+
+		delete[] buffer;
+		delete[] sine;
+		PCMCacheMan.clear();
+	}
+
+	void test_long_stream_not_cached() {
+		PCMCacheMan.clear();
+		const uint32 maxLength = PCMCacheMan.getMaxLength();
+		PCMCacheMan.setMaxLength(1000);
+
+		Audio::SeekableAudioStream *s = createSineStream<int8>(11025, 2, 0, false, false);
+		TS_ASSERT_EQUALS(PCMCacheMan.addStream("long", s), s);
+		TS_ASSERT(!PCMCacheMan.getStream("long"));
+		TS_ASSERT_EQUALS(PCMCacheMan.getMemory(), (uint32)0);
+		delete s;
+
+		PCMCacheMan.setMaxLength(maxLength);
+	}
+
+	void test_eviction() {
+		PCMCacheMan.clear();
+		const uint32 maxMemory = PCMCacheMan.getMaxMemory();
+		// Room for one second of 11025Hz mono audio
+		PCMCacheMan.setMaxMemory(11025 * 2);
+
+		delete PCMCacheMan.addStream("a", createSineStream<int8>(11025, 1, 0, false, false));
+		delete PCMCacheMan.addStream("b", createSineStream<int8>(11025, 1, 0, false, false));
+		TS_ASSERT_EQUALS(PCMCacheMan.getMemory(), (uint32)(11025 * 2));
+
+		Audio::SeekableAudioStream *a = PCMCacheMan.getStream("a");
+		Audio::SeekableAudioStream *b = PCMCacheMan.getStream("b");
+		TS_ASSERT(!a);
+		TS_ASSERT(b);
+		delete b;
+
+		PCMCacheMan.clear();
+		PCMCacheMan.setMaxMemory(maxMemory);
+	}
+
+	void test_too_big_not_evicting() {
+		PCMCacheMan.clear();
+		const uint32 maxMemory = PCMCacheMan.getMaxMemory();
+		PCMCacheMan.setMaxMemory(11025 * 2);
+
+		delete PCMCacheMan.addStream("a", createSineStream<int8>(11025, 1, 0, false, false));
+
+		// A sound which does not fit at all is played, but leaves the cache alone
+		Audio::SeekableAudioStream *big = PCMCacheMan.addStream("big", createSineStream<int8>(11025, 2, 0, false, false));
+		TS_ASSERT(big);
+		TS_ASSERT_EQUALS(big->getLength().totalNumberOfFrames(), 11025 * 2);
+		delete big;
+
+		TS_ASSERT(!PCMCacheMan.getStream("big"));
+		Audio::SeekableAudioStream *a = PCMCacheMan.getStream("a");
+		TS_ASSERT(a);
+		delete a;
+
+		PCMCacheMan.clear();
+		PCMCacheMan.setMaxMemory(maxMemory);
+	}
+};
@@ -0,0 +1,119 @@
+#include <cxxtest/TestSuite.h>
+
+#include "common/memstream.h"
+#include "common/cachedstream.h"
+
+class CachedSeekableReadStreamTestSuite : public CxxTest::TestSuite {
+	public:
+	void test_traverse() {
+		byte contents[10] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+		Common::MemoryReadStream ms(contents, 10);
+
+		Common::CachedSeekableReadStream csrs(&ms, 4, 2);
+
+		byte i, b;
+		for (i = 0; i < 10; ++i) {
+			TS_ASSERT(!csrs.eos());
+
+			TS_ASSERT_EQUALS(i, csrs.pos());
+
+			csrs.read(&b, 1);
+			TS_ASSERT_EQUALS(i, b);
+		}
+
+		TS_ASSERT(!csrs.eos());
+
+		TS_ASSERT_EQUALS((uint)0, csrs.read(&b, 1));
+		TS_ASSERT(csrs.eos());
+
+		// The second block was read ahead together with the first one
+		TS_ASSERT_EQUALS(csrs.getReadAheads(), 1u);
+		TS_ASSERT_EQUALS(csrs.getMisses(), 2u);
+	}
+
+	void test_seek() {
+		byte contents[10] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+		Common::MemoryReadStream ms(contents, 10);
+
+		Common::CachedSeekableReadStream csrs(&ms, 4, 2);
+		byte b;
+
+		TS_ASSERT_EQUALS(csrs.pos(), 0);
+
+		csrs.seek(1, SEEK_SET);
+		TS_ASSERT_EQUALS(csrs.pos(), 1);
+		b = csrs.readByte();
+		TS_ASSERT_EQUALS(b, 1);
+
+		csrs.seek(5, SEEK_CUR);
+		TS_ASSERT_EQUALS(csrs.pos(), 7);
+		b = csrs.readByte();
+		TS_ASSERT_EQUALS(b, 7);
+
+		csrs.seek(-3, SEEK_CUR);
+		TS_ASSERT_EQUALS(csrs.pos(), 5);
+		b = csrs.readByte();
+		TS_ASSERT_EQUALS(b, 5);
+
+		csrs.seek(0, SEEK_END);
+		TS_ASSERT_EQUALS(csrs.pos(), 10);
+		TS_ASSERT(!csrs.eos());
+		b = csrs.readByte();
+		TS_ASSERT(csrs.eos());
+
+		csrs.seek(-3, SEEK_END);
+		TS_ASSERT(!csrs.eos());
+		TS_ASSERT_EQUALS(csrs.pos(), 7);
+		b = csrs.readByte();
+		TS_ASSERT_EQUALS(b, 7);
+
+		csrs.seek(-8, SEEK_END);
+		TS_ASSERT_EQUALS(csrs.pos(), 2);
+		b = csrs.readByte();
+		TS_ASSERT_EQUALS(b, 2);
+	}
+
+	void test_cache() {
+		byte contents[64];
+		for (int i = 0; i < 64; ++i)
+			contents[i] = i;
+		Common::MemoryReadStream ms(contents, 64);
+
+		Common::CachedSeekableReadStream csrs(&ms, 8, 2);
+		byte buffer[12];
+
+		// Jumping between two blocks only reads each of them once
+		for (int i = 0; i < 4; ++i) {
+			csrs.seek(2);
+			TS_ASSERT_EQUALS(csrs.readByte(), 2);
+			csrs.seek(40);
+			TS_ASSERT_EQUALS(csrs.readByte(), 40);
+		}
+		TS_ASSERT_EQUALS(csrs.getMisses(), 2u);
+		TS_ASSERT_EQUALS(csrs.getHits(), 6u);
+
+		// Reads spanning blocks
+		csrs.seek(30);
+		TS_ASSERT_EQUALS(csrs.read(buffer, 12), 12u);
+		for (int i = 0; i < 12; ++i)
+			TS_ASSERT_EQUALS(buffer[i], 30 + i);
+
+		// Prefetched data doesn't need to be read anymore
+		const uint32 misses = csrs.getMisses();
+		csrs.prefetch(50, 14);
+		csrs.seek(50);
+		TS_ASSERT_EQUALS(csrs.read(buffer, 12), 12u);
+		TS_ASSERT_EQUALS(csrs.getMisses(), misses);
+		for (int i = 0; i < 12; ++i)
+			TS_ASSERT_EQUALS(buffer[i], 50 + i);
+
+		// Reads larger than the cache bypass it
+		csrs.seek(60);
+		TS_ASSERT_EQUALS(csrs.read(buffer, 12), 4u);
+		TS_ASSERT(csrs.eos());
+		csrs.seek(0);
+		byte large[20];
+		TS_ASSERT_EQUALS(csrs.read(large, 20), 20u);
+		TS_ASSERT_EQUALS(large[19], 19);
+	}
+};
@@ -0,0 +1,111 @@
+#include <cxxtest/TestSuite.h>
+
+#include "common/archive.h"
+#include "common/memstream.h"
+
+/**
+ * Archive containing a single empty file, counting how often it is asked
+ * whether it has a file.
+ */
+class CountingArchive : public Common::Archive {
+public:
+	CountingArchive(const Common::String &fileName) : _fileName(fileName), _lookups(0), _deleted(false) {}
+
+	virtual bool hasFile(const Common::String &name) const {
+		++_lookups;
+		return name == _fileName;
+	}
+
+	virtual int listMembers(Common::ArchiveMemberList &list) const {
+		list.push_back(getMember(_fileName));
+		return 1;
+	}
+
+	virtual const Common::ArchiveMemberPtr getMember(const Common::String &name) const {
+		return Common::ArchiveMemberPtr(new Common::GenericArchiveMember(name, this));
+	}
+
+	virtual Common::SeekableReadStream *createReadStreamForMember(const Common::String &name) const {
+		if (name != _fileName || _deleted)
+			return 0;
+		return new Common::MemoryReadStream(0, 0);
+	}
+
+	Common::String _fileName;
+	mutable int _lookups;
+	bool _deleted;
+};
+
+class SearchSetTestSuite : public CxxTest::TestSuite {
+	public:
+	void test_lookup_cache() {
+		CountingArchive a("a"), b("b");
+		Common::SearchSet set;
+		set.add("a", &a, 1, false);
+		set.add("b", &b, 0, false);
+
+		TS_ASSERT(set.hasFile("b"));
+		TS_ASSERT_EQUALS(a._lookups, 1);
+		TS_ASSERT_EQUALS(b._lookups, 1);
+
+		Common::SeekableReadStream *stream = set.createReadStreamForMember("b");
+		TS_ASSERT(stream);
+		delete stream;
+		TS_ASSERT(set.getMember("b"));
+		TS_ASSERT_EQUALS(a._lookups, 1);
+		TS_ASSERT_EQUALS(b._lookups, 1);
+
+		// Missing files are remembered as well
+		TS_ASSERT(!set.hasFile("c"));
+		TS_ASSERT(!set.createReadStreamForMember("c"));
+		TS_ASSERT_EQUALS(a._lookups, 2);
+		TS_ASSERT_EQUALS(b._lookups, 2);
+	}
+
+	void test_lookup_cache_invalidation() {
+		CountingArchive a("a"), c("c");
+		Common::SearchSet set;
+		set.add("a", &a, 0, false);
+
+		TS_ASSERT(!set.hasFile("c"));
+
+		set.add("c", &c, 0, false);
+		TS_ASSERT(set.hasFile("c"));
+
+		set.remove("c");
+		TS_ASSERT(!set.hasFile("c"));
+	}
+
+	void test_lookup_cache_stale() {
+		CountingArchive a("a"), b("a");
+		Common::SearchSet set;
+		set.add("first", &a, 1, false);
+		set.add("second", &b, 0, false);
+
+		TS_ASSERT(set.hasFile("a"));
+
+		// A file which vanished after the lookup is opened from the next
+		// archive having it
+		a._deleted = true;
+		Common::SeekableReadStream *stream = set.createReadStreamForMember("a");
+		TS_ASSERT(stream);
+		delete stream;
+
+		// The stale entry has been dropped from the cache
+		TS_ASSERT_EQUALS(a._lookups, 1);
+		TS_ASSERT(set.hasFile("a"));
+		TS_ASSERT_EQUALS(a._lookups, 2);
+	}
+
+	void test_lookup_cache_nested() {
+		CountingArchive a("a");
+		Common::SearchSet inner, outer;
+		outer.add("inner", &inner, 0, false);
+
+		TS_ASSERT(!outer.hasFile("a"));
+
+		// Changing a nested set must be noticed by the outer one
+		inner.add("a", &a, 0, false);
+		TS_ASSERT(outer.hasFile("a"));
+	}
+};